@@ -15,9 +15,12 @@
 #include <cstring>
 #endif
 
+#include "elf_def/builtin.hpp"
 #include "elf_def/const.hpp"
 #include "elf_def/ident.hpp"
 #include "elf_def/hash.hpp"
+#include "elf_def/relr.hpp"
+#include "elf_def/string.hpp"
 #include "elf_def/struct.hpp"
 #include "elf_def/types.hpp"
 
@@ -29,19 +32,7 @@ class ELF : public ELF_Def::Structures<C> {
 	using Def = typename ELF_Def::Structures<C>;
 	using elfptr_t = typename Def::Elf_Addr;
 
-	/*! \brief Wrapper for Builtins
-	 * with overloaded parameter for different data types */
-	struct Builtin {
-		// Count trailing zeros
-		static int ctz(unsigned int value) { return __builtin_ctz(value); }
-		static int ctz(unsigned long value) { return __builtin_ctzl(value); }
-		static int ctz(unsigned long long value) { return __builtin_ctzll(value); }
-
-		// Population count (number of 1s)
-		static int popcount(unsigned int value) { return __builtin_popcount(value); }
-		static int popcount(unsigned long value) { return __builtin_popcountl(value); }
-		static int popcount(unsigned long long value) { return __builtin_popcountll(value); }
-	};
+	using Builtin = ELF_Def::Builtin;
 
 	/*! \brief Start address of ELF in memory */
 	inline uintptr_t start() const {
@@ -322,6 +313,126 @@ class ELF : public ELF_Def::Structures<C> {
 		}
 	};
 
+	/*! \brief List with random access
+	 * Walks a \ref List once and stores the offsets of its elements in a caller-provided buffer,
+	 * providing constant time \ref at, \ref count and reverse iteration afterwards.
+	 * Elements exceeding the buffer are still accessible (by walking from the last indexed element).
+	 * \tparam A class
+	 */
+	template <typename A>
+	class IndexedList : public List<A> {
+	 public:
+		/*! \brief Reverse iterator */
+		class ReverseIterator {
+			/*! \brief Indexed list */
+			const IndexedList<A> & list;
+
+			/*! \brief Index of current element plus one */
+			size_t position;
+
+		 public:
+			/*! \brief Reverse iterator constructor
+			 * \param list indexed list
+			 * \param position index of current element plus one (`0` indicates end)
+			 */
+			ReverseIterator(const IndexedList<A> & list, size_t position)
+			  : list{list}, position{position} {}
+
+			/*! \brief Previous element */
+			ReverseIterator & operator++() {
+				assert(position > 0);
+				position--;
+				return *this;
+			}
+
+			/*! \brief Compare current iterator element */
+			bool operator==(const ReverseIterator & other) const {
+				return position == other.position;
+			}
+
+			/*! \brief Compare current iterator element */
+			bool operator!=(const ReverseIterator & other) const {
+				return position != other.position;
+			}
+
+			/*! \brief Get current element */
+			A operator*() const {
+				return list.at(position - 1);
+			}
+		};
+
+		/*! \brief Index list
+		 * \param list List to index
+		 * \param buffer memory for the element offsets (must stay valid while this object is used)
+		 * \param size number of entries in buffer (should be at least the number of list elements)
+		 */
+		IndexedList(const List<A> & list, uint32_t * buffer, size_t size)
+		  : List<A>{list}, _offset{buffer}, _indexed{0}, _count{0} {
+			const uintptr_t first = this->address();
+			for (const auto & entry : list) {
+				if (_count < size) {
+					assert(entry.address() - first <= 0xffffffff);
+					_offset[_indexed++] = static_cast<uint32_t>(entry.address() - first);
+				}
+				_count++;
+			}
+		}
+
+		/*! \brief Array-like access
+		 * \param idx index
+		 * \return Accessor for element
+		 */
+		A operator[](size_t idx) const {
+			return at(idx);
+		}
+
+		/*! \brief Array-like access
+		 * \note O(1) complexity for indexed elements
+		 * \param idx index
+		 * \return Accessor for element
+		 */
+		A at(size_t idx) const {
+			assert(idx < _count);
+			if (idx < _indexed)
+				return this->_accessor_value(this->_accessor, reinterpret_cast<void *>(this->address() + _offset[idx]));
+			// Walk from the last indexed element
+			Iterator<A> i = _indexed == 0 ? this->begin() : Iterator<A>{at(_indexed - 1)};
+			for (size_t n = _indexed == 0 ? 0 : _indexed - 1; n < idx; n++)
+				++i;
+			return *i;
+		}
+
+		/*! \brief Number of elements in list */
+		size_t count() const {
+			return _count;
+		}
+
+		/*! \brief Are all elements indexed? */
+		bool complete() const {
+			return _indexed == _count;
+		}
+
+		/*! \brief Get reverse iterator for last element */
+		ReverseIterator rbegin() const {
+			return ReverseIterator{*this, _count};
+		}
+
+		/*! \brief Get reverse iterator indicating end of reversed list */
+		ReverseIterator rend() const {
+			return ReverseIterator{*this, 0};
+		}
+
+	 private:
+		/*! \brief Offset of each indexed element (relative to the first element) */
+		uint32_t * const _offset;
+
+		/*! \brief Number of indexed elements */
+		size_t _indexed;
+
+		/*! \brief Number of elements in list */
+		size_t _count;
+	};
+
 
 	/*! \brief ELF Header */
 	struct Header : Def::Ehdr {
@@ -387,6 +498,9 @@ class ELF : public ELF_Def::Structures<C> {
 	struct Dynamic;
 	struct DynamicTable;
 
+	/*! \brief Forward declaration for address translation index */
+	struct LoadMap;
+
 	// Segments (Program header table)
 	struct Segment : Accessor<typename Def::Phdr> {
 		/*! \brief Constructor for new Segment entry */
@@ -475,8 +589,19 @@ class ELF : public ELF_Def::Structures<C> {
 			return DynamicTable{this->_elf, dyn, entries, strtaboff, !mapped};
 		}
 
+		/*! \brief Get contents of dynamic secion (file not mapped to the segments)
+		 * \param loads address translation index (must stay valid while the table is used)
+		 */
+		DynamicTable get_dynamic_table(const LoadMap & loads) const {
+			assert(type() == Def::PT_DYNAMIC);
+			size_t entries = 0;
+			uintptr_t strtaboff = 0;
+			void * dyn = load_dynamic(false, strtaboff, entries, &loads);
+			return DynamicTable{this->_elf, dyn, entries, strtaboff, loads};
+		}
+
 	 private:
-		void * load_dynamic(bool mapped, uintptr_t & strtaboff, size_t & entries) const {
+		void * load_dynamic(bool mapped, uintptr_t & strtaboff, size_t & entries, const LoadMap * loads = nullptr) const {
 			// Static, non relocatable binaries use absolute addressing
 			bool absolute_address = this->_elf.header.type() == Def::ET_EXEC;
 
@@ -496,7 +621,7 @@ class ELF : public ELF_Def::Structures<C> {
 					strtaboff = dyn[entries].d_un.d_val;
 
 			if (!mapped)
-				strtaboff = DynamicTable::translate(this->_elf, strtaboff);
+				strtaboff = DynamicTable::translate(this->_elf, loads, strtaboff);
 			else if (absolute_address)
 				strtaboff -= this->_elf.start();
 			else
@@ -612,9 +737,42 @@ class ELF : public ELF_Def::Structures<C> {
 	 * Use hash if possible
 	 */
 	struct SymbolTable : public Array<Symbol> {
+		/*! \brief Slot of the auxiliary lookup index */
+		struct IndexSlot {
+			/*! \brief GNU hash of the symbol name */
+			uint32_t hash;
+			/*! \brief Symbol index (or STN_UNDEF for an empty slot) */
+			uint32_t index;
+		};
+
+		/*! \brief Counters for hash table lookups (see \ref set_statistics) */
+		struct Statistics {
+			/*! \brief Lookups using a hash table */
+			uint64_t lookups;
+			/*! \brief Lookups rejected by the bloom filter (GNU hash) */
+			uint64_t bloom_rejections;
+			/*! \brief Lookups answered by the negative cache */
+			uint64_t cache_hits;
+			/*! \brief Entries inserted into the negative cache */
+			uint64_t cache_inserts;
+			/*! \brief Lookups ending at an empty bucket */
+			uint64_t bucket_empty;
+			/*! \brief Visited hash chain entries */
+			uint64_t chain_steps;
+			/*! \brief String comparisons of symbol names (not rejected by their cached length) */
+			uint64_t strcmp_calls;
+		};
+
+		/*! \brief Pseudo version index to request the default version of a symbol (like `dlsym`):
+		 * Unversioned symbols and versions not marked as hidden are accepted
+		 */
+		static const uint16_t default_version = 0x8000;
+
 		const typename Def::shdr_type section_type;
 		const void * header;
 		const uint16_t * const versions;
+		/*! \brief Size of string table (or 0 if unknown) */
+		const size_t strtabsize;
 		using Array<Symbol>::operator[];
 		using Array<Symbol>::index;
 
@@ -638,14 +796,23 @@ class ELF : public ELF_Def::Structures<C> {
 		 * \param symtabentries Number of entries in symbol table
 		 * \param versions Pointer versions array (for symbol table) if available (otherwise: `nullptr`)
 		 * \param strtaboff Offset in elf file to string table
+		 * \param strtabsize Size of string table (or 0 if unknown)
 		 */
-		SymbolTable(const ELF<C> & elf, const typename Def::shdr_type section_type, const void * header, void * symtab, size_t symtabentries, const uint16_t * versions, uintptr_t strtaboff)
-		  : Array<Symbol>{ Symbol{ elf, strtaboff}, symtab, symtabentries}, section_type{section_type}, header{header}, versions{versions} {}
+		SymbolTable(const ELF<C> & elf, const typename Def::shdr_type section_type, const void * header, void * symtab, size_t symtabentries, const uint16_t * versions, uintptr_t strtaboff, size_t strtabsize = 0)
+		  : Array<Symbol>{ Symbol{ elf, strtaboff}, symtab, symtabentries}, section_type{section_type}, header{header}, versions{versions}, strtabsize{strtabsize} {}
 
 		/*! \brief Empty (non-existing) symbol table
 		 */
 		explicit SymbolTable(const ELF<C> & elf)
-		  : Array<Symbol>{Symbol{elf}, 0, 0}, section_type{Def::SHT_NULL}, header{nullptr}, versions{nullptr} {}
+		  : Array<Symbol>{Symbol{elf}, 0, 0}, section_type{Def::SHT_NULL}, header{nullptr}, versions{nullptr}, strtabsize{0} {}
+
+		/*! \brief Symbol table using an external GNU hash table (e.g. generated by \ref GnuHashTable)
+		 * \param symbols symbol table
+		 * \param header Pointer to GNU hash header
+		 * \param order symbol index for each position in the GNU hash chain (or `nullptr` if the symbols are in chain order)
+		 */
+		SymbolTable(const SymbolTable & symbols, const void * header, const uint32_t * order)
+		  : Array<Symbol>{symbols}, section_type{Def::SHT_GNU_HASH}, header{header}, versions{symbols.versions}, strtabsize{symbols.strtabsize}, gnuhash_order{order} {}
 
 		/*! \brief Elf object */
 		const ELF<C> & elf() const {
@@ -683,14 +850,25 @@ class ELF : public ELF_Def::Structures<C> {
 		size_t index(const char * search_name, uint16_t required_version = Def::VER_NDX_GLOBAL) const {
 			if (required_version != Def::VER_NDX_GLOBAL && versions == nullptr)
 				required_version = Def::VER_NDX_GLOBAL;
+			uint32_t length;
 			switch (section_type) {
 				case Def::SHT_HASH:
-					return index_by_hash(search_name, ELF_Def::hash(search_name), required_version);
+				{
+					const uint32_t hash_value = ELF_Def::hash(search_name, length);
+					return index_by_hash(search_name, length, hash_value, required_version);
+				}
 				case Def::SHT_GNU_HASH:
-					return index_by_gnuhash(search_name, ELF_Def::gnuhash(search_name), required_version);
+				{
+					const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(search_name, length));
+					return index_by_gnuhash(search_name, length, hash_value, required_version);
+				}
 				case Def::SHT_DYNSYM:
 				case Def::SHT_SYMTAB:
-					return index_by_strcmp(search_name, required_version);
+					if (lookup_index != nullptr) {
+						const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(search_name, length));
+						return index_by_lookup_index(search_name, length, hash_value, required_version);
+					}
+					return index_by_strcmp(search_name, ELF_Def::length(search_name), required_version);
 				default:
 					return Def::STN_UNDEF;
 			}
@@ -705,21 +883,82 @@ class ELF : public ELF_Def::Structures<C> {
 		 * \return index of object or STN_UNDEF
 		 */
 		size_t index(const char * search_name, uint32_t hash_value, uint32_t gnu_hash_value, uint16_t required_version = Def::VER_NDX_GLOBAL) const {
+			return index(search_name, ELF_Def::length(search_name), hash_value, gnu_hash_value, required_version);
+		}
+
+		/*! \brief Find symbol using calculated length and hash values
+		 * \note Undefined symbols are usually excluded from hash hence they might not be found using this method!
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \param hash_value elf hash value of symbol_name
+		 * \param gnu_hash_value gnu hash value
+		 * \param required_version required version or VER_NDX_GLOBAL if none
+		 * \return index of object or STN_UNDEF
+		 */
+		size_t index(const char * search_name, uint32_t length, uint32_t hash_value, uint32_t gnu_hash_value, uint16_t required_version) const {
 			if (required_version != Def::VER_NDX_GLOBAL && versions == nullptr)
 				required_version = Def::VER_NDX_GLOBAL;
 			switch (section_type) {
 				case Def::SHT_HASH:
-					return index_by_hash(search_name, hash_value, required_version);
+					return index_by_hash(search_name, length, hash_value, required_version);
 				case Def::SHT_GNU_HASH:
-					return index_by_gnuhash(search_name, gnu_hash_value, required_version);
+					return index_by_gnuhash(search_name, length, gnu_hash_value, required_version);
 				case Def::SHT_DYNSYM:
 				case Def::SHT_SYMTAB:
-					return index_by_strcmp(search_name, required_version);
+					if (lookup_index != nullptr)
+						return index_by_lookup_index(search_name, length, gnu_hash_value, required_version);
+					return index_by_strcmp(search_name, length, required_version);
 				default:
 					return Def::STN_UNDEF;
 			}
 		}
 
+		/*! \brief Find symbol using a key with precomputed hash values
+		 * \note Undefined symbols are usually excluded from hash hence they might not be found using this method!
+		 * \param key symbol key (usually `constexpr`, hence without any hashing at runtime)
+		 * \param required_version required version or VER_NDX_GLOBAL if none
+		 * \return index of object or STN_UNDEF
+		 */
+		inline size_t index(const ELF_Def::SymbolKey & key, uint16_t required_version = Def::VER_NDX_GLOBAL) const {
+			return index(key.name, key.length, key.hash, key.gnuhash, required_version);
+		}
+
+		/*! \brief Find multiple symbols at once
+		 * The names are hashed first, then the bloom filter, buckets and chains are probed
+		 * for a batch of names at once (with software prefetching), hence the memory latency
+		 * of each probe overlaps with the others.
+		 * \note Undefined symbols are usually excluded from hash hence they might not be found using this method!
+		 * \param search_names array of symbol names to search
+		 * \param count number of symbol names
+		 * \param results array (with at least `count` elements) for the index of each object or STN_UNDEF
+		 * \param required_versions array (with `count` elements) of required versions, or `nullptr` if none
+		 */
+		void index_many(const char * const * search_names, size_t count, uint32_t * results, const uint16_t * required_versions = nullptr) const {
+			if (versions == nullptr)
+				required_versions = nullptr;
+
+			uint32_t hash_values[batch_size];
+			uint32_t lengths[batch_size];
+			for (size_t offset = 0; offset < count; offset += batch_size) {
+				const size_t n = count - offset < batch_size ? count - offset : batch_size;
+				const char * const * names = search_names + offset;
+				const uint16_t * required = required_versions == nullptr ? nullptr : required_versions + offset;
+				switch (section_type) {
+					case Def::SHT_HASH:
+						ELF_Def::hash_bulk(names, n, hash_values, lengths);
+						index_many_by_hash(names, lengths, hash_values, n, results + offset, required);
+						break;
+					case Def::SHT_GNU_HASH:
+						ELF_Def::gnuhash_bulk(names, n, hash_values, lengths);
+						index_many_by_gnuhash(names, lengths, hash_values, n, results + offset, required);
+						break;
+					default:
+						for (size_t i = 0; i < n; i++)
+							results[offset + i] = index(names[i], required_version(required, i));
+				}
+			}
+		}
+
 		/*! \brief Access symbol by char* index
 		 * \param search_name symbol name to search
 		 * \return Symbol
@@ -728,14 +967,148 @@ class ELF : public ELF_Def::Structures<C> {
 			return operator[](index(search_name));  // 0 == UNDEF
 		}
 
+		/*! \brief Access symbol by key with precomputed hash values
+		 * \param key symbol key
+		 * \return Symbol
+		 */
+		inline Symbol operator[](const ELF_Def::SymbolKey & key) const {
+			return operator[](index(key));  // 0 == UNDEF
+		}
+
+		/*! \brief Check if a symbol might be contained in this table
+		 * Uses the bloom filter of a GNU hash table to quickly reject symbols
+		 * \param gnu_hash_value gnu hash value of symbol name
+		 * \return `false` if the symbol is definitely not in this table
+		 */
+		inline bool may_contain(uint32_t gnu_hash_value) const {
+			if (section_type != Def::SHT_GNU_HASH || gnuhash_bloom(gnu_hash_value))
+				return true;
+			statistic(&Statistics::lookups);
+			statistic(&Statistics::bloom_rejections);
+			return false;
+		}
+
+		/*! \brief Number of slots required for the auxiliary lookup index of this table
+		 * \return power of two with at least twice the number of symbols
+		 */
+		size_t lookup_index_slots() const {
+			size_t slots = 16;
+			while (slots < 2 * this->count())
+				slots *= 2;
+			return slots;
+		}
+
+		/*! \brief Build an auxiliary lookup index for a symbol or dynamic symbol table without hash section
+		 * The index is an open addressing hash table (keyed by the GNU hash of the symbol name),
+		 * replacing the linear string comparison in subsequent lookups.
+		 * It is built once into caller-provided memory, which must stay valid while this symbol table is used
+		 * \param slots memory for the index
+		 * \param size number of slots (power of two, at least \ref lookup_index_slots)
+		 * \return `true` if the index was built, `false` if the memory is insufficient or the table has a hash section
+		 */
+		bool build_lookup_index(IndexSlot * slots, size_t size) {
+			if ((section_type != Def::SHT_DYNSYM && section_type != Def::SHT_SYMTAB) || slots == nullptr || size < lookup_index_slots())
+				return false;
+			assert((size & (size - 1)) == 0);
+
+			for (size_t i = 0; i < size; i++)
+				slots[i] = { 0, Def::STN_UNDEF };
+
+			// Insertion in symbol order (linear probing) keeps the first definition of a name in front of later ones
+			const uint32_t mask = static_cast<uint32_t>(size - 1);
+			const auto entries = this->count();
+			for (uint32_t i = 1; i < entries; i++) {
+				const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(name(i)));
+				uint32_t s = hash_value & mask;
+				while (slots[s].index != Def::STN_UNDEF)
+					s = (s + 1) & mask;
+				slots[s] = { hash_value, i };
+			}
+
+			lookup_index = slots;
+			lookup_index_mask = mask;
+			return true;
+		}
+
+		/*! \brief Has an auxiliary lookup index? */
+		bool has_lookup_index() const {
+			return lookup_index != nullptr;
+		}
+
+		/*! \brief Use a negative cache for lookups in the hash table
+		 * The direct mapped cache stores misses keyed by hash value and required version --
+		 * but only if no symbol with the same hash value (and a suitable version) exists,
+		 * hence a cache hit is valid regardless of the symbol name.
+		 * Entries are accessed atomically, so the cache may be shared by multiple threads (lock-free).
+		 * \param slots memory for the cache (or `nullptr` to disable), must stay valid while this symbol table is used
+		 * \param size number of slots (power of two)
+		 */
+		void set_negative_cache(uint64_t * slots, size_t size) {
+			assert(slots == nullptr || (size > 0 && (size & (size - 1)) == 0));
+			if (slots != nullptr)
+				for (size_t i = 0; i < size; i++)
+					__atomic_store_n(slots + i, 0, __ATOMIC_RELAXED);
+			negative_cache = slots;
+			negative_cache_mask = slots == nullptr ? 0 : static_cast<uint32_t>(size - 1);
+		}
+
+		/*! \brief Count hash table lookups
+		 * Counters are incremented atomically (relaxed)
+		 * \param statistics counters to increment (or `nullptr` to disable), must stay valid while this symbol table is used
+		 */
+		void set_statistics(Statistics * statistics) {
+			this->statistics = statistics;
+		}
+
+		/*! \brief Cache the length of all symbol names
+		 * Symbol names with a different length are rejected without accessing the string table.
+		 * \param lengths memory for the name lengths, must stay valid while this symbol table is used
+		 * \param size number of elements in `lengths` (at least the number of symbols)
+		 * \return `true` if the lengths were cached
+		 */
+		bool build_name_lengths(uint32_t * lengths, size_t size) {
+			const auto entries = this->count();
+			if (lengths == nullptr || size < entries)
+				return false;
+			lengths[0] = 0;
+			for (uint32_t i = 1; i < entries; i++)
+				lengths[i] = ELF_Def::length(name(i));
+			name_lengths = lengths;
+			return true;
+		}
+
 	 private:
+		/*! \brief Symbol index for each GNU hash chain position (or `nullptr` for identity) */
+		const uint32_t * gnuhash_order = nullptr;
+
+		/*! \brief Cached name lengths (see \ref build_name_lengths) */
+		const uint32_t * name_lengths = nullptr;
+
+		/*! \brief Negative cache (see \ref set_negative_cache) */
+		uint64_t * negative_cache = nullptr;
+
+		/*! \brief Mask (number of slots - 1) for negative cache */
+		uint32_t negative_cache_mask = 0;
+
+		/*! \brief Lookup counters (see \ref set_statistics) */
+		Statistics * statistics = nullptr;
+
+		/*! \brief Auxiliary lookup index (see \ref build_lookup_index) */
+		const IndexSlot * lookup_index = nullptr;
+
+		/*! \brief Mask (number of slots - 1) for auxiliary lookup index */
+		uint32_t lookup_index_mask = 0;
+
+		/*! \brief Number of names probed in parallel by \ref index_many */
+		static const size_t batch_size = 16;
+
 		/*! \brief Helper constructor */
 		SymbolTable(const ELF<C> & elf, bool use_hash, const Section & section, const Section & version_section)
 		  : SymbolTable{elf, section.type(), use_hash ? section.data() : nullptr, use_hash ? elf.sections.at(section.link()) : section, version_section} {}
 
 		/*! \brief Helper constructor */
 		SymbolTable(const ELF<C> & elf, const typename Def::shdr_type section_type, void * header, const Section & symbol_section, const Section & version_section)
-		  : SymbolTable{elf, section_type, header, elf.data(symbol_section.offset()), symbol_section.entries(), version_section.type() == Def::SHT_GNU_VERSYM ? version_section.get_versions() : nullptr, elf.sections.at(symbol_section.link()).offset()} {
+		  : SymbolTable{elf, section_type, header, elf.data(symbol_section.offset()), symbol_section.entries(), version_section.type() == Def::SHT_GNU_VERSYM ? version_section.get_versions() : nullptr, elf.sections.at(symbol_section.link()).offset(), elf.sections.at(symbol_section.link()).size()} {
 			assert(section_type == Def::SHT_GNU_HASH || section_type == Def::SHT_HASH || section_type == Def::SHT_DYNSYM || section_type == Def::SHT_SYMTAB);
 			assert(section_type == Def::SHT_DYNSYM || section_type == Def::SHT_SYMTAB || header != nullptr);
 		}
@@ -743,78 +1116,451 @@ class ELF : public ELF_Def::Structures<C> {
 		/*! \brief Find symbol index using ELF Hash
 		 * \see https://flapenguin.me/elf-dt-hash
 		 * \param search_name symbol name to search
+		 * \param length length of symbol name
 		 * \param hash_value elf hash value of symbol_name
 		 * \return index of object or STN_UNDEF
 		 */
-		uint32_t index_by_hash(const char *search_name, uint32_t hash_value, uint16_t required_version) const {
+		uint32_t index_by_hash(const char *search_name, uint32_t length, uint32_t hash_value, uint16_t required_version) const {
 			const ELF_Def::Hash_header * header = reinterpret_cast<const ELF_Def::Hash_header*>(this->header);
 			const uint32_t * bucket = reinterpret_cast<const uint32_t *>(header + 1);
-			const uint32_t * chain = bucket + header->nbucket;
 
-			for (uint32_t i = bucket[hash_value % (header->nbucket)]; i != 0; i = chain[i])
-				if (!strcmp(search_name, SymbolTable::name(i)) && check_version(i, required_version))
-					return i;
+			statistic(&Statistics::lookups);
+			if (negative_cache_contains(hash_value, required_version))
+				return Def::STN_UNDEF;
 
-			return Def::STN_UNDEF;
+			const uint32_t first = bucket[hash_value % (header->nbucket)];
+			if (first == 0) {
+				statistic(&Statistics::bucket_empty);
+				return Def::STN_UNDEF;
+			}
+
+			const uint32_t result = hash_chain(search_name, length, first, required_version);
+			if (result == Def::STN_UNDEF)
+				negative_cache_insert_hash(hash_value, first, required_version);
+			return result;
+		}
+
+		/*! \brief Find multiple symbol indices using ELF Hash
+		 * \param search_names symbol names to search
+		 * \param lengths lengths of the symbol names
+		 * \param hash_values elf hash values of the symbol names
+		 * \param n number of symbol names (must not exceed \ref batch_size)
+		 * \param results array for the index of each object or STN_UNDEF
+		 * \param required_versions array of required versions or `nullptr` if none
+		 */
+		void index_many_by_hash(const char * const * search_names, const uint32_t * lengths, const uint32_t * hash_values, size_t n, uint32_t * results, const uint16_t * required_versions) const {
+			const ELF_Def::Hash_header * header = reinterpret_cast<const ELF_Def::Hash_header*>(this->header);
+			const uint32_t * bucket = reinterpret_cast<const uint32_t *>(header + 1);
+			const uint32_t nbucket = header->nbucket;
+
+			statistic(&Statistics::lookups, n);
+
+			// Prefetch buckets
+			for (size_t i = 0; i < n; i++)
+				Builtin::prefetch(bucket + hash_values[i] % nbucket);
+
+			// Read buckets and prefetch first symbol of each chain
+			for (size_t i = 0; i < n; i++) {
+				results[i] = bucket[hash_values[i] % nbucket];
+				Builtin::prefetch(this->_accessor._data + results[i]);
+			}
+
+			// Walk chains
+			for (size_t i = 0; i < n; i++) {
+				const uint16_t version = required_version(required_versions, i);
+				if (results[i] == Def::STN_UNDEF) {
+					statistic(&Statistics::bucket_empty);
+				} else if (negative_cache_contains(hash_values[i], version)) {
+					results[i] = Def::STN_UNDEF;
+				} else {
+					const uint32_t first = results[i];
+					results[i] = hash_chain(search_names[i], lengths[i], first, version);
+					if (results[i] == Def::STN_UNDEF)
+						negative_cache_insert_hash(hash_values[i], first, version);
+				}
+			}
+		}
+
+		/*! \brief Walk ELF Hash chain
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \param first first symbol index in chain (from bucket)
+		 * \param required_version required version or VER_NDX_GLOBAL if none
+		 * \return index of object or STN_UNDEF
+		 */
+		uint32_t hash_chain(const char *search_name, uint32_t length, uint32_t first, uint16_t required_version) const {
+			const ELF_Def::Hash_header * header = reinterpret_cast<const ELF_Def::Hash_header*>(this->header);
+			const uint32_t * chain = reinterpret_cast<const uint32_t *>(header + 1) + header->nbucket;
+
+			uint64_t steps = 0;
+			uint64_t compares = 0;
+			uint32_t i = first;
+			for (; i != 0; i = chain[i]) {
+				steps++;
+				if (name_rejected(i, length))
+					continue;
+				compares++;
+				if (name_compare(i, search_name, length) && check_version(i, required_version))
+					break;
+			}
+
+			statistic(&Statistics::chain_steps, steps);
+			statistic(&Statistics::strcmp_calls, compares);
+			return i;
 		}
 
 		/*! \brief Find symbol index using ELF Hash
 		 * \see https://blogs.oracle.com/solaris/gnu-hash-elf-sections-v2
 		 * \see https://flapenguin.me/elf-dt-gnu-hash
 		 * \param search_name symbol name to search
+		 * \param length length of symbol name
 		 * \param hash_value gnu hash value
 		 * \return index of object or STN_UNDEF
 		 */
-		uint32_t index_by_gnuhash(const char *search_name, uint32_t hash_value, uint16_t required_version) const {
+		uint32_t index_by_gnuhash(const char *search_name, uint32_t length, uint32_t hash_value, uint16_t required_version) const {
+			const ELF_Def::GnuHash_header * header = reinterpret_cast<const ELF_Def::GnuHash_header*>(this->header);
+			const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
+			const uint32_t * buckets = reinterpret_cast<const uint32_t *>(bloom + header->bloom_size);
+
+			statistic(&Statistics::lookups);
+			if (!gnuhash_bloom(hash_value)) {
+				statistic(&Statistics::bloom_rejections);
+				return Def::STN_UNDEF;
+			}
+
+			if (negative_cache_contains(hash_value, required_version))
+				return Def::STN_UNDEF;
+
+			uint32_t n = buckets[hash_value % header->nbuckets];
+			if (n == 0) {
+				statistic(&Statistics::bucket_empty);
+				return Def::STN_UNDEF;
+			}
+
+			const uint32_t result = gnuhash_chain(search_name, length, hash_value, n, required_version);
+			if (result == Def::STN_UNDEF)
+				negative_cache_insert_gnuhash(hash_value, n, required_version);
+			return result;
+		}
+
+		/*! \brief Find multiple symbol indices using GNU Hash
+		 * \param search_names symbol names to search
+		 * \param lengths lengths of the symbol names
+		 * \param hash_values gnu hash values of the symbol names
+		 * \param n number of symbol names (must not exceed \ref batch_size)
+		 * \param results array for the index of each object or STN_UNDEF
+		 * \param required_versions array of required versions or `nullptr` if none
+		 */
+		void index_many_by_gnuhash(const char * const * search_names, const uint32_t * lengths, const uint32_t * hash_values, size_t n, uint32_t * results, const uint16_t * required_versions) const {
 			const ELF_Def::GnuHash_header * header = reinterpret_cast<const ELF_Def::GnuHash_header*>(this->header);
 			const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
 			const uint32_t * buckets = reinterpret_cast<const uint32_t *>(bloom + header->bloom_size);
 			const uint32_t * chain = buckets + header->nbuckets;
+			const uint32_t c = sizeof(elfptr_t) * 8;
+
+			statistic(&Statistics::lookups, n);
+
+			// Prefetch bloom filter words
+			for (size_t i = 0; i < n; i++)
+				Builtin::prefetch(bloom + (hash_values[i] / c) % header->bloom_size);
+
+			// Check bloom filter (and negative cache) and prefetch buckets of candidates
+			for (size_t i = 0; i < n; i++) {
+				if (!gnuhash_bloom(hash_values[i])) {
+					statistic(&Statistics::bloom_rejections);
+					results[i] = Def::STN_UNDEF;
+				} else {
+					results[i] = negative_cache_contains(hash_values[i], required_version(required_versions, i)) ? Def::STN_UNDEF : 1;
+				}
+				if (results[i] != Def::STN_UNDEF)
+					Builtin::prefetch(buckets + hash_values[i] % header->nbuckets);
+			}
+
+			// Read buckets and prefetch chain hash values
+			uint32_t first[batch_size];
+			for (size_t i = 0; i < n; i++)
+				if (results[i] != Def::STN_UNDEF) {
+					results[i] = first[i] = buckets[hash_values[i] % header->nbuckets];
+					if (results[i] != Def::STN_UNDEF)
+						Builtin::prefetch(chain + (results[i] - header->symoffset));
+					else
+						statistic(&Statistics::bucket_empty);
+				}
+
+			// Find first candidate with matching hash value and prefetch its symbol
+			uint32_t candidates[batch_size];
+			for (size_t i = 0; i < n; i++) {
+				candidates[i] = Def::STN_UNDEF;
+				if (results[i] != Def::STN_UNDEF) {
+					uint64_t steps = 0;
+					for (uint32_t sym = results[i]; true; sym++) {
+						const uint32_t h2 = chain[sym - header->symoffset];
+						if ((hash_values[i] & ~1U) == (h2 & ~1U)) {
+							candidates[i] = sym;
+							Builtin::prefetch(this->_accessor._data + gnuhash_symbol(sym));
+							break;
+						}
+						steps++;
+						if ((h2 & 1) != 0) {
+							results[i] = Def::STN_UNDEF;
+							negative_cache_insert(hash_values[i], required_version(required_versions, i));
+							break;
+						}
+					}
+					statistic(&Statistics::chain_steps, steps);
+				}
+			}
+
+			// Prefetch name of candidates
+			for (size_t i = 0; i < n; i++)
+				if (candidates[i] != Def::STN_UNDEF)
+					Builtin::prefetch(name(gnuhash_symbol(candidates[i])));
+
+			// Walk chains (starting at the candidate)
+			for (size_t i = 0; i < n; i++)
+				if (candidates[i] != Def::STN_UNDEF) {
+					const uint16_t version = required_version(required_versions, i);
+					results[i] = gnuhash_chain(search_names[i], lengths[i], hash_values[i], candidates[i], version);
+					if (results[i] == Def::STN_UNDEF)
+						negative_cache_insert_gnuhash(hash_values[i], first[i], version);
+				}
+		}
+
+		/*! \brief Check GNU Hash bloom filter
+		 * \param hash_value gnu hash value
+		 * \return `false` if the symbol is definitely not in the table
+		 */
+		bool gnuhash_bloom(uint32_t hash_value) const {
+			const ELF_Def::GnuHash_header * header = reinterpret_cast<const ELF_Def::GnuHash_header*>(this->header);
+			const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
 
 			const uint32_t c = sizeof(elfptr_t) * 8;
 			const elfptr_t one = 1;
 			const elfptr_t mask = (one << (hash_value % c))
 			                    | (one << ((hash_value >> header->bloom_shift) % c));
 
-			elfptr_t n = (hash_value / c) % header->bloom_size;
-			if ((bloom[n] & mask) != mask)
-				return Def::STN_UNDEF;
-
-			n = buckets[hash_value % header->nbuckets];
-			if (n == 0)
-				return Def::STN_UNDEF;
+			return (bloom[(hash_value / c) % header->bloom_size] & mask) == mask;
+		}
 
-			const uint32_t * hashval = chain + (n - header->symoffset);
+		/*! \brief Walk GNU Hash chain
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \param hash_value gnu hash value
+		 * \param n first symbol index in chain (from bucket)
+		 * \param required_version required version or VER_NDX_GLOBAL if none
+		 * \return index of object or STN_UNDEF
+		 */
+		uint32_t gnuhash_chain(const char *search_name, uint32_t length, uint32_t hash_value, uint32_t n, uint16_t required_version) const {
+			const ELF_Def::GnuHash_header * header = reinterpret_cast<const ELF_Def::GnuHash_header*>(this->header);
+			const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
+			const uint32_t * buckets = reinterpret_cast<const uint32_t *>(bloom + header->bloom_size);
+			const uint32_t * hashval = buckets + header->nbuckets + (n - header->symoffset);
 
+			uint64_t steps = 0;
+			uint64_t compares = 0;
+			uint32_t result = Def::STN_UNDEF;
 			for (hash_value &= ~1; true; n++) {
 				uint32_t h2 = *hashval++;
-				if ((hash_value == (h2 & ~1)) && !strcmp(search_name, SymbolTable::name(n)) && check_version(n, required_version))
-					return n;
+				steps++;
+				if (hash_value == (h2 & ~1)) {
+					const uint32_t idx = gnuhash_symbol(n);
+					if (!name_rejected(idx, length)) {
+						compares++;
+						if (name_compare(idx, search_name, length) && check_version(idx, required_version)) {
+							result = idx;
+							break;
+						}
+					}
+				}
 				if ((h2 & 1) != 0)
 					break;
 			}
+			statistic(&Statistics::chain_steps, steps);
+			statistic(&Statistics::strcmp_calls, compares);
+			return result;
+		}
+
+		/*! \brief Get symbol index of a position in the GNU Hash chain
+		 * \param n position in chain
+		 * \return symbol index
+		 */
+		inline uint32_t gnuhash_symbol(uint32_t n) const {
+			return gnuhash_order == nullptr ? n : gnuhash_order[n];
+		}
+
+		/*! \brief Increment lookup counter (if statistics are enabled)
+		 * \param counter member of \ref Statistics
+		 * \param value increment
+		 */
+		inline void statistic(uint64_t Statistics::* counter, uint64_t value = 1) const {
+			if (statistics != nullptr && value != 0)
+				__atomic_fetch_add(&(statistics->*counter), value, __ATOMIC_RELAXED);
+		}
+
+		/*! \brief Slot and entry in the negative cache
+		 * \param hash_value hash value of symbol name
+		 * \param required_version required version
+		 * \param entry reference to store the (non-zero) cache entry
+		 * \return pointer to slot
+		 */
+		inline uint64_t * negative_cache_slot(uint32_t hash_value, uint16_t required_version, uint64_t & entry) const {
+			entry = (static_cast<uint64_t>(hash_value) << 32) | (static_cast<uint64_t>(required_version) << 16) | 1;
+			return negative_cache + ((hash_value ^ (required_version * 0x9e3779b1U)) & negative_cache_mask);
+		}
+
+		/*! \brief Check if the negative cache contains a miss
+		 * \param hash_value hash value of symbol name
+		 * \param required_version required version
+		 * \return `true` if there is no symbol with this hash value and version
+		 */
+		bool negative_cache_contains(uint32_t hash_value, uint16_t required_version) const {
+			if (negative_cache == nullptr)
+				return false;
+			uint64_t entry;
+			const uint64_t * slot = negative_cache_slot(hash_value, required_version, entry);
+			if (__atomic_load_n(slot, __ATOMIC_RELAXED) != entry)
+				return false;
+			statistic(&Statistics::cache_hits);
+			return true;
+		}
+
+		/*! \brief Insert a miss into the negative cache (replacing the previous entry in its slot)
+		 * \param hash_value hash value of symbol name
+		 * \param required_version required version
+		 */
+		void negative_cache_insert(uint32_t hash_value, uint16_t required_version) const {
+			if (negative_cache != nullptr) {
+				uint64_t entry;
+				uint64_t * slot = negative_cache_slot(hash_value, required_version, entry);
+				__atomic_store_n(slot, entry, __ATOMIC_RELAXED);
+				statistic(&Statistics::cache_inserts);
+			}
+		}
+
+		/*! \brief Insert a miss into the negative cache if no symbol in the ELF hash chain has the same hash value and a suitable version
+		 * \param hash_value elf hash value of symbol name
+		 * \param first first symbol index in chain (from bucket)
+		 * \param required_version required version
+		 */
+		void negative_cache_insert_hash(uint32_t hash_value, uint32_t first, uint16_t required_version) const {
+			if (negative_cache != nullptr) {
+				const ELF_Def::Hash_header * header = reinterpret_cast<const ELF_Def::Hash_header*>(this->header);
+				const uint32_t * chain = reinterpret_cast<const uint32_t *>(header + 1) + header->nbucket;
+				for (uint32_t i = first; i != 0; i = chain[i])
+					if (ELF_Def::hash(SymbolTable::name(i)) == hash_value && check_version(i, required_version))
+						return;
+				negative_cache_insert(hash_value, required_version);
+			}
+		}
+
+		/*! \brief Insert a miss into the negative cache if no symbol in the GNU hash chain has the same hash value and a suitable version
+		 * \param hash_value gnu hash value of symbol name
+		 * \param n first symbol index in chain (from bucket)
+		 * \param required_version required version
+		 */
+		void negative_cache_insert_gnuhash(uint32_t hash_value, uint32_t n, uint16_t required_version) const {
+			if (negative_cache != nullptr) {
+				const ELF_Def::GnuHash_header * header = reinterpret_cast<const ELF_Def::GnuHash_header*>(this->header);
+				const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
+				const uint32_t * buckets = reinterpret_cast<const uint32_t *>(bloom + header->bloom_size);
+				const uint32_t * hashval = buckets + header->nbuckets + (n - header->symoffset);
+				for (; true; n++) {
+					const uint32_t h2 = *hashval++;
+					if ((hash_value & ~1U) == (h2 & ~1U) && check_version(gnuhash_symbol(n), required_version))
+						return;
+					if ((h2 & 1) != 0)
+						break;
+				}
+				negative_cache_insert(hash_value, required_version);
+			}
+		}
+
+		/*! \brief Find symbol index using the auxiliary lookup index
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \param hash_value gnu hash value of symbol_name
+		 * \param required_version required version or VER_NDX_GLOBAL if none
+		 * \return index of object or STN_UNDEF
+		 */
+		uint32_t index_by_lookup_index(const char *search_name, uint32_t length, uint32_t hash_value, uint16_t required_version) const {
+			assert(lookup_index != nullptr);
+			for (uint32_t s = hash_value & lookup_index_mask; lookup_index[s].index != Def::STN_UNDEF; s = (s + 1) & lookup_index_mask) {
+				const uint32_t i = lookup_index[s].index;
+				if (lookup_index[s].hash == hash_value && name_equals(i, search_name, length) && check_version(i, required_version))
+					return i;
+			}
 			return Def::STN_UNDEF;
 		}
 
 		/*! \brief Find symbol index using string comparison
 		 * \param search_name symbol name to search
+		 * \param length length of symbol name
 		 * \return index of object or STN_UNDEF
 		 */
-		uint32_t index_by_strcmp(const char *search_name, uint16_t required_version) const {
+		uint32_t index_by_strcmp(const char *search_name, uint32_t length, uint16_t required_version) const {
 			const auto entries = this->count();
 			for (uint32_t i = 1; i < entries; i++)
-				if (!strcmp(search_name, name(i)) && check_version(i, required_version))
+				if (name_equals(i, search_name, length) && check_version(i, required_version))
 					return i;
 			return Def::STN_UNDEF;
 		}
 
+		/*! \brief Compare symbol name with search name of known length
+		 * Rejects by cached name length (if available) and compares word-wise
+		 * without reading beyond the search name or the end of the string table.
+		 * If neither name lengths nor the size of the string table are known,
+		 * the names are compared bytewise up to the first null byte instead.
+		 * \param idx symbol index
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \return `true` if the name of the symbol equals the search name
+		 */
+		inline bool name_equals(uint32_t idx, const char * search_name, uint32_t length) const {
+			return !name_rejected(idx, length) && name_compare(idx, search_name, length);
+		}
+
+		/*! \brief Cheap rejection of a symbol name without accessing the string table
+		 * \param idx symbol index
+		 * \param length length of symbol name
+		 * \return `true` if the symbol name cannot have the given length
+		 */
+		inline bool name_rejected(uint32_t idx, uint32_t length) const {
+			if (name_lengths != nullptr)
+				return name_lengths[idx] != length;
+			const uint32_t offset = this->_accessor._data[idx].st_name;
+			// Name (including terminating null byte) would exceed string table
+			return strtabsize != 0 && (offset >= strtabsize || strtabsize - offset <= length);
+		}
+
+		/*! \brief Compare symbol name (not rejected by `name_rejected`) with search name
+		 * \param idx symbol index
+		 * \param search_name symbol name to search
+		 * \param length length of symbol name
+		 * \return `true` if the name of the symbol equals the search name
+		 */
+		inline bool name_compare(uint32_t idx, const char * search_name, uint32_t length) const {
+			const uint32_t offset = this->_accessor._data[idx].st_name;
+			if (name_lengths == nullptr && strtabsize == 0)
+				// Unknown bounds: the symbol name might end (with the string table) before the search name does
+				return strcmp(search_name, elf().string(this->_accessor.strtaboff, offset)) == 0;
+			// Including the terminating null byte
+			return ELF_Def::equal(search_name, elf().string(this->_accessor.strtaboff, offset), length + 1);
+		}
+
+		/*! \brief Helper to get the required version from an optional array
+		 */
+		static inline uint16_t required_version(const uint16_t * required_versions, size_t idx) {
+			return required_versions == nullptr ? static_cast<uint16_t>(Def::VER_NDX_GLOBAL) : required_versions[idx];
+		}
+
 		/*! \brief Helper to compare version
 		 */
 		inline bool check_version(size_t idx, uint16_t required_version) const {
 			return required_version == Def::VER_NDX_GLOBAL
-			    || (versions[idx] & 0x7fff) == Def::VER_NDX_GLOBAL
 			    || versions == nullptr
-			    || required_version == (versions[idx] & 0x7fff);
+			    || (versions[idx] & 0x7fff) == Def::VER_NDX_GLOBAL
+			    || required_version == (versions[idx] & 0x7fff)
+			    || (required_version == default_version && (versions[idx] & 0x8000) == 0);
 		}
 	};
 
@@ -1208,7 +1954,7 @@ class ELF : public ELF_Def::Structures<C> {
 		 * \return Accessor for element
 		 */
 		uintptr_t operator[](size_t idx) const {
-			return at(idx);
+			return at(idx).offset();
 		}
 
 		/*! \brief Array-like access
@@ -1221,7 +1967,7 @@ class ELF : public ELF_Def::Structures<C> {
 				if (idx-- == 0)
 					return entry;
 			assert(false);
-			return { this->_accessor };
+			return typename Iterator::Entry{ this->_accessor };
 		}
 
 		/*! \brief Number of entries */
@@ -1239,6 +1985,65 @@ class ELF : public ELF_Def::Structures<C> {
 			return entries;
 		}
 
+		/*! \brief Decode all offsets at once
+		 * Faster than the iterator, since each bitmap entry is expanded in a single step
+		 * \param offsets array for the decoded offsets
+		 * \param size number of elements in array (should be at least \ref offset_count)
+		 * \return number of offsets in the list -- if it exceeds `size`, only the first `size` offsets have been stored
+		 */
+		size_t decode(uintptr_t * offsets, size_t size) const {
+			size_t n = 0;
+			uintptr_t where = 0;
+			for (const typename Def::Relr * relr = this->_accessor._data; relr != this->_end; relr++) {
+				const elfptr_t value = relr->r_value;
+				if ((value & 1) == 0) {
+					if (n < size)
+						offsets[n] = value;
+					n++;
+					where = value + sizeof(elfptr_t);
+				} else {
+					if (n + 8 * sizeof(elfptr_t) - 1 <= size) {
+						n += ELF_Def::relr_bitmap(where, value, offsets + n);
+					} else {
+						// Not enough space for a full bitmap: expand into a temporary buffer
+						uintptr_t bitmap[8 * sizeof(elfptr_t) - 1];
+						const size_t bits = ELF_Def::relr_bitmap(where, value, bitmap);
+						for (size_t i = 0; i < bits; i++, n++)
+							if (n < size)
+								offsets[n] = bitmap[i];
+					}
+					where += (8 * sizeof(elfptr_t) - 1) * sizeof(elfptr_t);
+				}
+			}
+			return n;
+		}
+
+		/*! \brief Apply all relative relocations
+		 * Adds the base address to every word referenced by the (decoded) offsets
+		 * \param base Base address in target memory of the object to which the relocations belong to
+		 * \param where Offset represented by a leading bitmap entry (for lists starting within a sequence of bitmap entries)
+		 * \return number of applied relocations
+		 */
+		size_t apply_relative(uintptr_t base, uintptr_t where = 0) const {
+			size_t applied = 0;
+			uintptr_t offsets[8 * sizeof(elfptr_t)];
+			for (const typename Def::Relr * relr = this->_accessor._data; relr != this->_end; relr++) {
+				const elfptr_t value = relr->r_value;
+				if ((value & 1) == 0) {
+					*reinterpret_cast<elfptr_t *>(base + value) += base;
+					where = value + sizeof(elfptr_t);
+					applied++;
+				} else {
+					const size_t n = ELF_Def::relr_bitmap(where, value, offsets);
+					for (size_t i = 0; i < n; i++)
+						*reinterpret_cast<elfptr_t *>(base + offsets[i]) += base;
+					where += (8 * sizeof(elfptr_t) - 1) * sizeof(elfptr_t);
+					applied += n;
+				}
+			}
+			return applied;
+		}
+
 		/*! \brief Are there any elements in the array?
 		 * \return `false` if there is at least one element
 		 */
@@ -1257,6 +2062,149 @@ class ELF : public ELF_Def::Structures<C> {
 		}
 	};
 
+	/*! \brief Relative relocations with random access to the decoded offsets
+	 * Stores the number of preceding offsets (prefix sum of \ref RelocationRelative::offset_count)
+	 * and the base offset of each entry in a caller-provided buffer,
+	 * hence the n-th decoded offset is found by a binary search.
+	 * Entries not fitting into the buffer are decoded sequentially on access.
+	 */
+	class IndexedRelocationRelativeList : public RelocationRelativeList {
+	 public:
+		/*! \brief Index of an entry */
+		struct Index {
+			/*! \brief Number of offsets represented by the preceding entries */
+			size_t first;
+			/*! \brief Offset of the first word represented by the entry (for bitmaps) or the offset itself */
+			uintptr_t where;
+		};
+
+		/*! \brief Index relative relocations
+		 * \param list relative relocations
+		 * \param buffer memory for the index (must stay valid while this object is used)
+		 * \param size number of elements in buffer (should be at least `list.count()`)
+		 * \param where Offset represented by a leading bitmap entry (for lists starting within a sequence of bitmap entries)
+		 */
+		IndexedRelocationRelativeList(const RelocationRelativeList & list, Index * buffer, size_t size, uintptr_t where = 0)
+		  : RelocationRelativeList{list}, _index{buffer}, _indexed{0}, _offsets{0}, _tail{0, 0} {
+			size_t i = 0;
+			for (const typename Def::Relr * relr = this->_accessor._data; relr != this->_end; relr++, i++) {
+				const elfptr_t value = relr->r_value;
+				if (i < size)
+					_index[_indexed++] = { _offsets, (value & 1) == 0 ? static_cast<uintptr_t>(value) : where };
+				else if (i == size)
+					_tail = { _offsets, where };
+				advance(value, _offsets, where);
+			}
+			if (i <= size)
+				_tail = { _offsets, where };
+		}
+
+		/*! \brief Number of offsets in list
+		 * \note O(1) complexity
+		 */
+		size_t offset_count() const {
+			return _offsets;
+		}
+
+		/*! \brief Are all entries indexed? */
+		bool complete() const {
+			return _indexed == this->count();
+		}
+
+		/*! \brief Index of the entry containing a decoded offset
+		 * \param idx index of the decoded offset
+		 * \return entry index
+		 */
+		size_t entry(size_t idx) const {
+			Index current;
+			return locate(idx, current);
+		}
+
+		/*! \brief Array-like access
+		 * \note O(log n) complexity
+		 * \param idx index of the decoded offset
+		 * \return offset
+		 */
+		uintptr_t operator[](size_t idx) const {
+			return at(idx);
+		}
+
+		/*! \brief Array-like access
+		 * \note O(log n) complexity
+		 * \param idx index of the decoded offset
+		 * \return offset
+		 */
+		uintptr_t at(size_t idx) const {
+			Index current;
+			const size_t e = locate(idx, current);
+			const elfptr_t value = this->_accessor._data[e].r_value;
+			if ((value & 1) == 0)
+				return value;
+			// Skip the preceding set bits of the bitmap
+			elfptr_t bitmap = value >> 1;
+			for (size_t n = idx - current.first; n > 0; n--)
+				bitmap &= bitmap - 1;
+			return current.where + Builtin::ctz(bitmap) * sizeof(elfptr_t);
+		}
+
+	 private:
+		/*! \brief Index of each entry */
+		Index * const _index;
+
+		/*! \brief Number of indexed entries */
+		size_t _indexed;
+
+		/*! \brief Number of decoded offsets */
+		size_t _offsets;
+
+		/*! \brief Index values of the first entry not fitting into the buffer */
+		Index _tail;
+
+		/*! \brief Advance the number of offsets and the offset represented by the next bitmap past an entry
+		 * \param value entry value
+		 * \param offsets number of offsets represented by the preceding entries
+		 * \param where offset represented by a following bitmap entry
+		 */
+		static void advance(elfptr_t value, size_t & offsets, uintptr_t & where) {
+			if ((value & 1) == 0) {
+				where = value + sizeof(elfptr_t);
+				offsets++;
+			} else {
+				where += (8 * sizeof(elfptr_t) - 1) * sizeof(elfptr_t);
+				offsets += Builtin::popcount(value) - 1;
+			}
+		}
+
+		/*! \brief Find the entry containing a decoded offset
+		 * \param idx index of the decoded offset
+		 * \param current index values of the entry
+		 * \return entry index
+		 */
+		size_t locate(size_t idx, Index & current) const {
+			assert(idx < _offsets);
+			if (idx < _tail.first) {
+				// Last indexed entry with idx >= first (bitmaps without any set bit share their first value with the successor)
+				const Index * base = _index;
+				for (size_t n = _indexed; n > 1; n -= n / 2)
+					base = base[n / 2].first <= idx ? base + n / 2 : base;
+				current = *base;
+				return static_cast<size_t>(base - _index);
+			}
+			// Decode the entries beyond the buffer sequentially
+			size_t e = _indexed;
+			size_t offsets = _tail.first;
+			uintptr_t where = _tail.where;
+			while (true) {
+				const elfptr_t value = this->_accessor._data[e].r_value;
+				current = { offsets, (value & 1) == 0 ? static_cast<uintptr_t>(value) : where };
+				advance(value, offsets, where);
+				if (idx < offsets)
+					return e;
+				e++;
+			}
+		}
+	};
+
 
 	/*! \brief Dynamic table entry */
 	struct Dynamic : Accessor<typename Def::Dyn> {
@@ -1628,9 +2576,168 @@ class ELF : public ELF_Def::Structures<C> {
 			return { Auxiliary{this->_elf, strtaboff}, first, nullptr };
 		}
 
-		/*! \brief Number of version dependency auxiliary information */
-		uint16_t auxiliaries() const {
-			return this->_data->vn_cnt;
+		/*! \brief Number of version dependency auxiliary information */
+		uint16_t auxiliaries() const {
+			return this->_data->vn_cnt;
+		}
+	};
+
+	/*! \brief Address translation index of the loadable segments
+	 * Contains the `PT_LOAD` ranges sorted by virtual address (with precomputed file offset, file and memory size),
+	 * allowing a binary search (without data-dependent branches) to translate a virtual address into a file offset.
+	 */
+	struct LoadMap {
+		/*! \brief Location of a virtual address */
+		enum Location {
+			IN_FILE,     ///< Backed by file contents
+			IN_BSS,      ///< Only in memory (zero initialized part of a loadable segment)
+			NOT_LOADED   ///< Not part of any loadable segment
+		};
+
+		/*! \brief Loadable segment range */
+		struct Load {
+			/*! \brief Virtual address of the segment */
+			uintptr_t vaddr;
+			/*! \brief Offset of the segment in the file */
+			uintptr_t offset;
+			/*! \brief Size of the segment in the file */
+			size_t filesz;
+			/*! \brief Size of the segment in memory */
+			size_t memsz;
+		};
+
+		/*! \brief Maximum number of loadable segments in the index (others are handled by a linear search) */
+		static const size_t capacity = 8;
+
+		/*! \brief Create index of the loadable segments
+		 * \param elf ELF object
+		 */
+		explicit LoadMap(const ELF<C> & elf)
+		  : _elf(&elf), _count(0), _complete(true) {
+			for (const auto & s : elf.segments)
+				if (s.type() == Def::PT_LOAD) {
+					if (_count >= capacity) {
+						_complete = false;
+						break;
+					}
+					// Insertion sort (the segments should already be in ascending order)
+					size_t i = _count++;
+					for (; i > 0 && _load[i - 1].vaddr > s.virt_addr(); i--)
+						_load[i] = _load[i - 1];
+					_load[i] = { s.virt_addr(), s.offset(), s.size(), s.virt_size() };
+				}
+		}
+
+		/*! \brief Empty index (without any loadable segment) */
+		LoadMap()
+		  : _elf(nullptr), _count(0), _complete(true) {}
+
+		/*! \brief Number of loadable segments in the index */
+		size_t count() const {
+			return _count;
+		}
+
+		/*! \brief All loadable segments are in the index */
+		bool complete() const {
+			return _complete;
+		}
+
+		/*! \brief Get loadable segment range
+		 * \param i index (sorted by virtual address)
+		 * \return segment range
+		 */
+		const Load & load(size_t i) const {
+			assert(i < _count);
+			return _load[i];
+		}
+
+		/*! \brief Locate a virtual address
+		 * \note For compatibility, the address right after the file contents of a segment is considered to be in the file
+		 * \param vaddr virtual address
+		 * \param offset file offset (only valid for \ref IN_FILE)
+		 * \return location of the address
+		 */
+		Location locate(uintptr_t vaddr, uintptr_t & offset) const {
+			if (!_complete)
+				return locate_linear(vaddr, offset);
+			if (_count == 0 || vaddr < _load[0].vaddr)
+				return NOT_LOADED;
+
+			// Last range starting at or below the address
+			const Load * base = _load;
+			for (size_t n = _count; n > 1; n -= n / 2)
+				base = base[n / 2].vaddr <= vaddr ? base + n / 2 : base;
+
+			// A range might end (inclusive) exactly at the start of its successor
+			if (base != _load && vaddr - base[-1].vaddr <= base[-1].filesz)
+				base--;
+
+			const uintptr_t displacement = vaddr - base->vaddr;
+			if (displacement <= base->filesz) {
+				offset = base->offset + displacement;
+				return IN_FILE;
+			}
+			return displacement < base->memsz ? IN_BSS : NOT_LOADED;
+		}
+
+		/*! \brief Locate a virtual address by scanning the program header table (without index)
+		 * \param elf ELF object
+		 * \param vaddr virtual address
+		 * \param offset file offset (only valid for \ref IN_FILE)
+		 * \return location of the address
+		 */
+		static Location scan(const ELF<C> & elf, uintptr_t vaddr, uintptr_t & offset) {
+			bool bss = false;
+			for (const auto & s : elf.segments)
+				if (s.type() == Def::PT_LOAD && vaddr >= s.virt_addr()) {
+					if (vaddr - s.virt_addr() <= s.size()) {
+						offset = vaddr - s.virt_addr() + s.offset();
+						return IN_FILE;
+					} else if (vaddr - s.virt_addr() < s.virt_size()) {
+						bss = true;
+					}
+				}
+			return bss ? IN_BSS : NOT_LOADED;
+		}
+
+		/*! \brief Translate multiple virtual addresses into file offsets
+		 * \param vaddrs virtual addresses
+		 * \param offsets array for the file offsets (`0` if not in file)
+		 * \param n number of addresses
+		 * \param locations optional array for the location of each address
+		 * \return number of addresses backed by file contents
+		 */
+		size_t translate(const uintptr_t * vaddrs, uintptr_t * offsets, size_t n, Location * locations = nullptr) const {
+			size_t in_file = 0;
+			for (size_t i = 0; i < n; i++) {
+				uintptr_t offset = 0;
+				const Location location = locate(vaddrs[i], offset);
+				offsets[i] = location == IN_FILE ? offset : 0;
+				if (locations != nullptr)
+					locations[i] = location;
+				if (location == IN_FILE)
+					in_file++;
+			}
+			return in_file;
+		}
+
+	 private:
+		/*! \brief ELF object */
+		const ELF<C> * _elf;
+
+		/*! \brief Sorted ranges */
+		Load _load[capacity];
+
+		/*! \brief Number of ranges */
+		size_t _count;
+
+		/*! \brief Number of loadable segments does not exceed \ref capacity */
+		bool _complete;
+
+		/*! \brief Locate virtual address by scanning the program header table */
+		Location locate_linear(uintptr_t vaddr, uintptr_t & offset) const {
+			assert(_elf != nullptr);
+			return scan(*_elf, vaddr, offset);
 		}
 	};
 
@@ -1639,6 +2746,53 @@ class ELF : public ELF_Def::Structures<C> {
 		/*! \brief Translate from virtual memory to file offset (required if not mapped according to segments) */
 		const bool translate_address;
 
+		/*! \brief Directory of the well-known tags
+		 * Decoded in a single pass over the dynamic array when the table is created,
+		 * hence the getters do not have to scan the whole array each time.
+		 * \note Only indices and counts are stored: table-valued entries (like `DT_SYMTAB`) are translated
+		 *       into pointers on each getter call -- provide a \ref LoadMap if the address translation is required
+		 */
+		struct Directory {
+			/*! \brief Number of tags in the standard range (`DT_NULL` to `DT_RELRENT`) */
+			static const size_t standard = Def::DT_NUM;
+
+			/*! \brief Number of slots: standard range, GNU version range (`DT_VERSYM` to `DT_VERNEEDNUM`) and `DT_GNU_HASH` */
+			static const size_t slots = standard + (Def::DT_VERNEEDNUM - Def::DT_VERSYM + 1) + 1;
+
+			/*! \brief Limit for the number of entries (also used as index of absent tags) */
+			static const uint16_t limit = 0xffff;
+
+			/*! \brief Saturated count: there are at least this many entries with the tag, which have to be counted */
+			static const uint8_t many = 0xff;
+
+			/*! \brief Index of the first entry of each well-known tag (\ref limit if there is none) */
+			uint16_t first[slots];
+
+			/*! \brief Index of the last entry of each well-known tag (\ref limit if there is none) */
+			uint16_t last[slots];
+
+			/*! \brief Number of entries of each well-known tag (up to \ref many) */
+			uint8_t counts[slots];
+
+			/*! \brief All entries are covered by the directory (the table has less than \ref limit entries) */
+			bool complete;
+
+			/*! \brief Slot of a tag
+			 * \param tag dynamic tag
+			 * \return slot index or \ref slots if the tag is not well-known
+			 */
+			static size_t slot(typename Def::dyn_tag tag) {
+				if (tag >= 0 && static_cast<size_t>(tag) < standard)
+					return static_cast<size_t>(tag);
+				else if (tag >= Def::DT_VERSYM && tag <= Def::DT_VERNEEDNUM)
+					return standard + static_cast<size_t>(tag - Def::DT_VERSYM);
+				else if (tag == Def::DT_GNU_HASH)
+					return slots - 1;
+				else
+					return slots;
+			}
+		};
+
 		/*! \brief Filter list entries */
 		struct Entry : public Dynamic {
 			/*! \brief Filter Tag */
@@ -1692,23 +2846,123 @@ class ELF : public ELF_Def::Structures<C> {
 		 * \param translate_address Difference between virtual address (used in dynamic) and file offset needs fix of offset
 		 */
 		DynamicTable(const ELF<C> & elf, void * dyntab, size_t dyntabentries, uintptr_t strtaboff, bool translate_address)
-		  : Array<Dynamic>{Dynamic{elf, strtaboff}, dyntab, dyntabentries}, translate_address{translate_address} {}
+		  : Array<Dynamic>{Dynamic{elf, strtaboff}, dyntab, dyntabentries}, translate_address{translate_address}, gnu_hash_entries{0}, _loads{nullptr} {
+			decode();
+		}
+
+		/*! \brief Dynamic table with address translation
+		 * \param elf Pointer to elf
+		 * \param dyntab Pointer to dynamic table
+		 * \param dyntabentries Number of entries in dynamic table
+		 * \param strtaboff Offset to associated string table
+		 * \param loads Address translation index of the elf (must stay valid while this table is used)
+		 */
+		DynamicTable(const ELF<C> & elf, void * dyntab, size_t dyntabentries, uintptr_t strtaboff, const LoadMap & loads)
+		  : Array<Dynamic>{Dynamic{elf, strtaboff}, dyntab, dyntabentries}, translate_address{true}, gnu_hash_entries{0}, _loads{&loads} {
+			decode();
+		}
 
 		/*! \brief Empty (non-existing) dynamic table */
 		explicit DynamicTable(const ELF<C> & elf)
-		  : Array<Dynamic>{Dynamic{elf}, 0, 0}, translate_address{false}  {}
+		  : Array<Dynamic>{Dynamic{elf}, 0, 0}, translate_address{false}, gnu_hash_entries{0}, _loads{nullptr} {
+			decode();
+		}
 
 		/*! \brief Get the corresponding ELF */
 		const ELF<C> & elf() const {
 			return this->_accessor._elf;
 		}
 
+		/*! \brief Directory of the well-known tags */
+		const Directory & directory() const {
+			return _directory;
+		}
+
+		/*! \brief Address translation index
+		 * \return pointer to index or `nullptr` if not provided (program header table is scanned instead)
+		 */
+		const LoadMap * loads() const {
+			return _loads;
+		}
+
+		/*! \brief Locate a virtual address (from the dynamic table) in the file
+		 * \param vaddr virtual address
+		 * \param offset relative offset to start of elf (only valid for `LoadMap::IN_FILE`)
+		 * \return location of the address (always `LoadMap::IN_FILE` if no translation is required)
+		 */
+		typename LoadMap::Location locate(uintptr_t vaddr, uintptr_t & offset) const {
+			if (translate_address)
+				return _loads != nullptr ? _loads->locate(vaddr, offset) : LoadMap::scan(elf(), vaddr, offset);
+			offset = fix_offset(vaddr);
+			return LoadMap::IN_FILE;
+		}
+
+		/*! \brief Index of an entry
+		 * \param tag dynamic tag to search
+		 * \param first get the first entry with this tag (otherwise the last one)
+		 * \return index of entry or \ref count if there is no such entry
+		 */
+		size_t index(typename Def::dyn_tag tag, bool first = false) const {
+			const size_t slot = Directory::slot(tag);
+			if (slot < Directory::slots && _directory.complete) {
+				const uint16_t i = first ? _directory.first[slot] : _directory.last[slot];
+				return i == Directory::limit ? this->count() : i;
+			}
+			// Not well-known tag: linear search
+			size_t result = this->count();
+			for (size_t i = 0; i < this->count(); i++)
+				if (entry_at(i).tag() == tag) {
+					result = i;
+					if (first)
+						break;
+				}
+			return result;
+		}
+
+		/*! \brief Number of entries with a tag
+		 * \note Constant time for well-known tags (unless there are \ref Directory::many entries), otherwise the array is scanned
+		 * \param tag dynamic tag
+		 * \return number of entries
+		 */
+		size_t count(typename Def::dyn_tag tag) const {
+			const size_t slot = Directory::slot(tag);
+			size_t from = 0;
+			size_t to = this->count();
+			if (slot < Directory::slots && _directory.complete) {
+				if (_directory.counts[slot] < Directory::many)
+					return _directory.counts[slot];
+				// Only the range between the first and last occurrence has to be counted
+				from = _directory.first[slot];
+				to = _directory.last[slot] + 1;
+			}
+			size_t n = 0;
+			for (size_t i = from; i < to; i++)
+				if (entry_at(i).tag() == tag)
+					n++;
+			return n;
+		}
+
+		using Array<Dynamic>::count;
+		using Array<Dynamic>::index;
+
+		/*! \brief Get value of an entry
+		 * \param tag dynamic tag to search
+		 * \param value reference to store the value (unchanged if there is no such entry)
+		 * \param first use the first entry with this tag (otherwise the last one)
+		 * \return `true` if there is an entry with this tag
+		 */
+		bool value(typename Def::dyn_tag tag, uintptr_t & value, bool first = false) const {
+			const size_t i = index(tag, first);
+			if (i == this->count())
+				return false;
+			value = entry_at(i).value();
+			return true;
+		}
+
 		/*! \brief Pointer to the global offset table */
 		const char * get_soname() const {
-			for (const auto & dyn : *this)
-				if (dyn.tag() == Def::DT_SONAME)
-					return dyn.string();
-			return nullptr;
+			const size_t i = index(Def::DT_SONAME, true);
+			return i == this->count() ? nullptr : entry_at(i).string();
 		}
 
 		/*! \brief get list of dependency library filename */
@@ -1736,28 +2990,22 @@ class ELF : public ELF_Def::Structures<C> {
 			uintptr_t strtab = 0;
 			void * symtab = nullptr;
 			size_t symtabnum = 0;
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			if (value(Def::DT_SYMTAB, v))
+				symtab = data(v);
+			assert(!value(Def::DT_SYMENT, v) || v == sizeof(typename Def::Sym));
+
+			// The later hash table entry determines the number of symbols
+			const size_t hash = index(Def::DT_HASH);
+			const size_t gnu_hash = index(Def::DT_GNU_HASH);
+			if (gnu_hash != this->count() && (hash == this->count() || gnu_hash > hash))
+				symtabnum = gnu_hash_count(reinterpret_cast<const ELF_Def::GnuHash_header*>(data(entry_at(gnu_hash).value())));
+			else if (hash != this->count())
+				symtabnum = reinterpret_cast<const ELF_Def::Hash_header*>(data(entry_at(hash).value()))->nchain;
 
-			for (const auto &dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_SYMTAB:
-						symtab = data(dyn.value());
-						break;
-					case Def::DT_SYMENT:
-						assert(dyn.value() == sizeof(typename Def::Sym));
-						break;
-					case Def::DT_HASH:
-						symtabnum = reinterpret_cast<const ELF_Def::Hash_header*>(data(dyn.value()))->nchain;
-						break;
-					case Def::DT_GNU_HASH:
-						symtabnum = gnu_hash_size(reinterpret_cast<const ELF_Def::GnuHash_header*>(data(dyn.value())));
-						break;
-				default:
-						continue;
-				}
-			}
 			assert(symtab != 0 && strtab != 0);
 			return { Symbol{elf(), strtab}, symtab, symtabnum };
 		}
@@ -1766,46 +3014,36 @@ class ELF : public ELF_Def::Structures<C> {
 		 */
 		SymbolTable get_symbol_table() const {
 			uintptr_t strtab = 0;
+			size_t strtabsize = 0;
 			void * symtab = nullptr;
 			size_t symtabnum = 0;
 			typename Def::shdr_type section_type = Def::SHT_DYNSYM;
 			void * header = nullptr;
 			const uint16_t * versions = nullptr;
-
-			for (const auto &dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_SYMTAB:
-						symtab = data(dyn.value());
-						break;
-					case Def::DT_SYMENT:
-						assert(dyn.value() == sizeof(typename Def::Sym));
-						break;
-					case Def::DT_VERSYM:
-						versions = reinterpret_cast<const uint16_t *>(data(dyn.value()));
-						break;
-					case Def::DT_HASH:
-						// Gnu hash is superior
-						if (section_type == Def::SHT_DYNSYM) {
-							section_type = Def::SHT_HASH;
-							header = data(dyn.value());
-							symtabnum = reinterpret_cast<const ELF_Def::Hash_header*>(header)->nchain;
-						}
-						break;
-					case Def::DT_GNU_HASH:
-						section_type = Def::SHT_GNU_HASH;
-						header = data(dyn.value());
-						symtabnum = gnu_hash_size(reinterpret_cast<const ELF_Def::GnuHash_header*>(header));
-						break;
-					default:
-						continue;
-				}
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			value(Def::DT_STRSZ, strtabsize);
+			if (value(Def::DT_SYMTAB, v))
+				symtab = data(v);
+			assert(!value(Def::DT_SYMENT, v) || v == sizeof(typename Def::Sym));
+			if (value(Def::DT_VERSYM, v))
+				versions = reinterpret_cast<const uint16_t *>(data(v));
+
+			// Gnu hash is superior
+			if (value(Def::DT_GNU_HASH, v)) {
+				section_type = Def::SHT_GNU_HASH;
+				header = data(v);
+				symtabnum = gnu_hash_count(reinterpret_cast<const ELF_Def::GnuHash_header*>(header));
+			} else if (value(Def::DT_HASH, v, true)) {
+				section_type = Def::SHT_HASH;
+				header = data(v);
+				symtabnum = reinterpret_cast<const ELF_Def::Hash_header*>(header)->nchain;
 			}
 			assert(symtab != nullptr && strtab != 0);
 			assert(header != nullptr);  // hash table is mandatory
-			return SymbolTable{elf(), section_type, header, symtab, symtabnum, versions, strtab};
+			return SymbolTable{elf(), section_type, header, symtab, symtabnum, versions, strtab, strtabsize};
 		}
 
 		/*! \brief Get contents of version definition section as \ref List of \ref VersionDefinition elements  */
@@ -1814,21 +3052,13 @@ class ELF : public ELF_Def::Structures<C> {
 			void * verdef = nullptr;
 			uintptr_t verdefnum = 0;
 
-			for (const auto & dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_VERDEF:
-						verdef = data(dyn.value());
-						break;
-					case Def::DT_VERDEFNUM:
-						verdefnum = dyn.value();
-						break;
-					default:
-						continue;
-				}
-			}
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			if (value(Def::DT_VERDEF, v))
+				verdef = data(v);
+			value(Def::DT_VERDEFNUM, verdefnum);
 
 			(void) verdefnum;
 			if (verdef == 0) {
@@ -1847,21 +3077,13 @@ class ELF : public ELF_Def::Structures<C> {
 			void * verneed = nullptr;
 			uintptr_t verneednum = 0;
 
-			for (const auto & dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_VERNEED:
-						verneed = data(dyn.value());
-						break;
-					case Def::DT_VERNEEDNUM:
-						verneednum = dyn.value();
-						break;
-					default:
-						continue;
-				}
-			}
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			if (value(Def::DT_VERNEED, v))
+				verneed = data(v);
+			value(Def::DT_VERNEEDNUM, verneednum);
 
 			(void) verneednum;
 			if (verneed == 0) {
@@ -1883,52 +3105,32 @@ class ELF : public ELF_Def::Structures<C> {
 			size_t relsz = 0;                           // Size of relocation table
 			size_t relent = 0;                          // Size of relocation table entry
 
-			for (const auto &dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_SYMTAB:
-						symtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_SYMENT:
-						assert(dyn.value() == sizeof(typename Def::Sym));
-						break;
-					case Def::DT_REL:
-						assert(type == Def::DT_NULL || type == Def::DT_REL);
-						type = Def::DT_REL;
-						rel = data(dyn.value());
-						break;
-					case Def::DT_RELA:
-						assert(type == Def::DT_NULL || type == Def::DT_RELA);
-						type = Def::DT_RELA;
-						rel = data(dyn.value());
-						break;
-					case Def::DT_RELSZ:
-						assert(type == Def::DT_NULL || type == Def::DT_REL);
-						type = Def::DT_REL;
-						relsz = dyn.value();
-						break;
-					case Def::DT_RELASZ:
-						assert(type == Def::DT_NULL || type == Def::DT_RELA);
-						type = Def::DT_RELA;
-						relsz = dyn.value();
-						break;
-					case Def::DT_RELENT:
-						assert(type == Def::DT_NULL || type == Def::DT_REL);
-						type = Def::DT_REL;
-						relent = dyn.value();
-						assert(relent == sizeof(typename Def::Rel));
-						break;
-					case Def::DT_RELAENT:
-						assert(type == Def::DT_NULL || type == Def::DT_RELA);
-						type = Def::DT_RELA;
-						relent = dyn.value();
-						assert(relent == sizeof(typename Def::Rela));
-						break;
-					default:
-						continue;
-				}
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			if (value(Def::DT_SYMTAB, v))
+				symtab = fix_offset(v);
+			assert(!value(Def::DT_SYMENT, v) || v == sizeof(typename Def::Sym));
+
+			// Either REL or RELA
+			const bool with_rel = count(Def::DT_REL) + count(Def::DT_RELSZ) + count(Def::DT_RELENT) > 0;
+			const bool with_rela = count(Def::DT_RELA) + count(Def::DT_RELASZ) + count(Def::DT_RELAENT) > 0;
+			assert(!with_rel || !with_rela);
+			if (with_rela) {
+				type = Def::DT_RELA;
+				if (value(Def::DT_RELA, v))
+					rel = data(v);
+				value(Def::DT_RELASZ, relsz);
+				value(Def::DT_RELAENT, relent);
+				assert(relent == 0 || relent == sizeof(typename Def::Rela));
+			} else if (with_rel) {
+				type = Def::DT_REL;
+				if (value(Def::DT_REL, v))
+					rel = data(v);
+				value(Def::DT_RELSZ, relsz);
+				value(Def::DT_RELENT, relent);
+				assert(relent == 0 || relent == sizeof(typename Def::Rel));
 			}
 
 			if (type == Def::DT_NULL) {
@@ -1949,27 +3151,17 @@ class ELF : public ELF_Def::Structures<C> {
 			typename Def::dyn_tag pltrel = Def::DT_NULL;  // Type of PLT relocation table (REL or RELA)
 			size_t pltrelsz = 0;                          // Size of PLT relocation table
 
-			for (const auto &dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_STRTAB:
-						strtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_SYMTAB:
-						symtab = fix_offset(dyn.value());
-						break;
-					case Def::DT_JMPREL:
-						jmprel = data(dyn.value());
-						break;
-					case Def::DT_PLTREL:
-						pltrel = static_cast<typename Def::dyn_tag>(dyn.value());
-						break;
-					case Def::DT_PLTRELSZ:
-						pltrelsz = dyn.value();
-						break;
-					default:
-						continue;
-				}
-			}
+			uintptr_t v;
+
+			if (value(Def::DT_STRTAB, v))
+				strtab = fix_offset(v);
+			if (value(Def::DT_SYMTAB, v))
+				symtab = fix_offset(v);
+			if (value(Def::DT_JMPREL, v))
+				jmprel = data(v);
+			if (value(Def::DT_PLTREL, v))
+				pltrel = static_cast<typename Def::dyn_tag>(v);
+			value(Def::DT_PLTRELSZ, pltrelsz);
 
 			switch (pltrel) {
 				case Def::DT_NULL:
@@ -1993,22 +3185,13 @@ class ELF : public ELF_Def::Structures<C> {
 			size_t relrsz = 0;                          // Size of relocation table
 			size_t relrent = 0;                         // Size of relocation table entry
 
-			for (const auto &dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_RELR:
-						relr = data(dyn.value());
-						break;
-					case Def::DT_RELRSZ:
-						relrsz = dyn.value();
-						break;
-					case Def::DT_RELRENT:
-						relrent = dyn.value();
-						assert(relrent == sizeof(typename Def::Relr));
-						break;
-					default:
-						continue;
-				}
-			}
+			uintptr_t v;
+
+			if (value(Def::DT_RELR, v))
+				relr = data(v);
+			value(Def::DT_RELRSZ, relrsz);
+			value(Def::DT_RELRENT, relrent);
+			assert(relrent == 0 || relrent == sizeof(typename Def::Relr));
 
 			if (relr == nullptr) {
 				assert(relrsz == 0 && relrent == 0);
@@ -2030,10 +3213,8 @@ class ELF : public ELF_Def::Structures<C> {
 
 		/*! \brief Get initialization function pointer */
 		func_init_t get_init_function(uintptr_t offset = 0) const {
-			for (const auto & dyn : *this)
-				if (dyn.tag() == Def::DT_INIT)
-					return reinterpret_cast<func_init_t>(dyn.value() + offset);
-			return nullptr;
+			uintptr_t v;
+			return value(Def::DT_INIT, v, true) ? reinterpret_cast<func_init_t>(v + offset) : nullptr;
 		}
 
 		/*! \brief Init functions array */
@@ -2064,10 +3245,8 @@ class ELF : public ELF_Def::Structures<C> {
 
 		/*! \brief Get deinitialization function pointer */
 		func_fini_t get_fini_function(uintptr_t offset = 0) const {
-			for (const auto & dyn : *this)
-				if (dyn.tag() == Def::DT_FINI)
-					return reinterpret_cast<func_fini_t>(dyn.value() + offset);
-			return nullptr;
+			uintptr_t v;
+			return value(Def::DT_FINI, v, true) ? reinterpret_cast<func_fini_t>(v + offset) : nullptr;
 		}
 
 		/*! \brief run deinitialization */
@@ -2087,28 +3266,21 @@ class ELF : public ELF_Def::Structures<C> {
 			size_t size = 0;
 			size_t entry_size = 0;
 
-			for (const auto & dyn : *this) {
-				switch (dyn.tag()) {
-					case Def::DT_PLTGOT:
-						got = data(dyn.value());
-						break;
-					case Def::DT_PLTRELSZ:
-						size = dyn.value();
+			uintptr_t v;
+
+			if (value(Def::DT_PLTGOT, v))
+				got = data(v);
+			value(Def::DT_PLTRELSZ, size);
+			if (value(Def::DT_PLTREL, v)) {
+				switch (v) {
+					case Def::DT_REL:
+						entry_size = sizeof(typename Def::Rel);
 						break;
-					case Def::DT_PLTREL:
-						switch(dyn.value()) {
-							case Def::DT_REL:
-								entry_size = sizeof(typename Def::Rel);
-								break;
-							case Def::DT_RELA:
-								entry_size = sizeof(typename Def::Rela);
-								break;
-							default:
-								assert(false);
-						}
+					case Def::DT_RELA:
+						entry_size = sizeof(typename Def::Rela);
 						break;
 					default:
-						continue;
+						assert(false);
 				}
 			}
 
@@ -2118,10 +3290,8 @@ class ELF : public ELF_Def::Structures<C> {
 
 		/*! \brief Pointer to the global offset table */
 		void** get_global_offset_table_pointer() const {
-			for (const auto & dyn : *this)
-				if (dyn.tag() == Def::DT_PLTGOT)
-					return reinterpret_cast<void**>(data(dyn.value()));
-			return nullptr;
+			uintptr_t v;
+			return value(Def::DT_PLTGOT, v, true) ? reinterpret_cast<void**>(data(v)) : nullptr;
 		}
 
 		/*! \brief Access (first) dynamic entry
@@ -2137,15 +3307,57 @@ class ELF : public ELF_Def::Structures<C> {
 		 * \return Dynamic entry
 		 */
 		inline Dynamic at(typename Def::dyn_tag tag) const {
-			for (const auto & dyn : *this)
-				if (dyn.tag() == tag)
-					return dyn;
-			return Dynamic{elf()};  // 0 == UNDEF
+			const size_t i = index(tag, true);
+			return i == this->count() ? Dynamic{elf()} : entry_at(i);  // 0 == UNDEF
 		}
 
 	 private:
 		friend struct Segment;
 
+		/*! \brief Directory of well-known tags */
+		Directory _directory;
+
+		/*! \brief Entry by index (\ref operator[] accesses by tag) */
+		Dynamic entry_at(size_t i) const {
+			return Array<Dynamic>::operator[](i);
+		}
+
+		/*! \brief Cached number of symbols according to the GNU hash table (or `0` if not determined yet) */
+		mutable size_t gnu_hash_entries;
+
+		/*! \brief Address translation index (or `nullptr` to scan the program header table) */
+		const LoadMap * _loads;
+
+		/*! \brief Decode the dynamic array into the directory (single pass) */
+		void decode() {
+			for (size_t s = 0; s < Directory::slots; s++) {
+				_directory.first[s] = _directory.last[s] = Directory::limit;
+				_directory.counts[s] = 0;
+			}
+			const size_t n = this->count();
+			_directory.complete = n < Directory::limit;
+			if (!_directory.complete)
+				return;
+			const typename Def::Dyn * dyn = this->_accessor._data;
+			for (size_t i = 0; i < n; i++) {
+				const size_t s = Directory::slot(static_cast<typename Def::dyn_tag>(dyn[i].d_tag));
+				if (s < Directory::slots) {
+					if (_directory.first[s] == Directory::limit)
+						_directory.first[s] = static_cast<uint16_t>(i);
+					_directory.last[s] = static_cast<uint16_t>(i);
+					if (_directory.counts[s] < Directory::many)
+						_directory.counts[s]++;
+				}
+			}
+		}
+
+		/*! \brief Number of entries in gnu hash table (cached) */
+		size_t gnu_hash_count(const ELF_Def::GnuHash_header* header) const {
+			if (gnu_hash_entries == 0)
+				gnu_hash_entries = gnu_hash_size(header);
+			return gnu_hash_entries;
+		}
+
 		/*! \brief Helper to determine the size of entries in gnu hash table */
 		static size_t gnu_hash_size(const ELF_Def::GnuHash_header* header) {
 			const elfptr_t * bloom = reinterpret_cast<const elfptr_t *>(header + 1);
@@ -2164,7 +3376,8 @@ class ELF : public ELF_Def::Structures<C> {
 
 		/*! \brief Helper to get filtered list */
 		List<Entry> get_entry(typename Def::dyn_tag filter) const {
-			return { Entry{elf(), this->_accessor.strtaboff, filter}, const_cast<void *>(reinterpret_cast<const void *>(Entry::find(this->_accessor._data, filter))), nullptr };
+			const size_t i = index(filter, true);
+			return { Entry{elf(), this->_accessor.strtaboff, filter}, i == this->count() ? nullptr : const_cast<void *>(reinterpret_cast<const void *>(this->_accessor._data + i)), nullptr };
 		}
 
 		/*! \brief Helper to get function pointer array */
@@ -2172,12 +3385,10 @@ class ELF : public ELF_Def::Structures<C> {
 		Array<Accessor<F, F>> get_func(typename Def::dyn_tag tag_start, typename Def::dyn_tag tag_size, uintptr_t offset = 0) const {
 			void * start = nullptr;
 			size_t size = 0;
-			for (const auto & dyn : *this) {
-				if (dyn.tag() == tag_start)
-					start = offset == 0 ? data(dyn.value()) : reinterpret_cast<void*>(offset + dyn.value());
-				else if (dyn.tag() == tag_size)
-					size = dyn.value();
-			}
+			uintptr_t v;
+			if (value(tag_start, v))
+				start = offset == 0 ? data(v) : reinterpret_cast<void*>(offset + v);
+			value(tag_size, size);
 			return { Accessor<F, F>{elf()}, start, size / sizeof(void*) };
 		}
 
@@ -2187,25 +3398,25 @@ class ELF : public ELF_Def::Structures<C> {
 			return reinterpret_cast<F>(reinterpret_cast<uintptr_t>(f) + offset);
 		}
 
-		/*! \brief translate virtual address according to load segments into offsets */
-		static uintptr_t translate(const ELF<C> & elf, uintptr_t offset) {
-			for (const auto & s : elf.segments)
-				if (s.type() == Def::PT_LOAD && offset >= s.virt_addr() && offset <= s.virt_addr() + s.size())  {
-					assert(offset + s.offset() >= s.virt_addr());
-					return offset + s.offset() - s.virt_addr();
-				}
-			// Memory not available (BSS?)
-			assert(false);
-			return 0;
+		/*! \brief translate virtual address according to load segments into offsets
+		 * \param elf ELF object
+		 * \param loads address translation index (or `nullptr` to scan the program header table)
+		 * \param offset virtual address
+		 * \return offset or `0` if the memory is not backed by the file (e.g. BSS)
+		 */
+		static uintptr_t translate(const ELF<C> & elf, const LoadMap * loads, uintptr_t offset) {
+			uintptr_t result = 0;
+			const auto location = loads != nullptr ? loads->locate(offset, result) : LoadMap::scan(elf, offset, result);
+			return location == LoadMap::IN_FILE ? result : 0;
 		}
 
 		/*! \brief fix virtual address offset if not mapped according to load segment
 		 *  \param offset value from dynamic table
-		 *  \return relative offset to start of elf
+		 *  \return relative offset to start of elf (`0` if not backed by the file)
 		 */
 		inline uintptr_t fix_offset(uintptr_t offset) const {
 			if (translate_address)
-				return translate(elf(), offset);
+				return translate(elf(), _loads, offset);
 			else if (elf().header.type() == Def::ET_EXEC)
 				return offset - elf().start();
 			else
@@ -2214,11 +3425,12 @@ class ELF : public ELF_Def::Structures<C> {
 
 		/*! \brief get ELF memory address
 		 *  \param offset value from dynamic table
-		 *  \return pointer to element in (current) memory
+		 *  \return pointer to element in (current) memory (`nullptr` if not backed by the file)
 		 */
 		inline void * data(uintptr_t offset) const {
+			uintptr_t file_offset;
 			if (translate_address)
-				return elf().data(translate(elf(), offset));
+				return locate(offset, file_offset) == LoadMap::IN_FILE ? elf().data(file_offset) : nullptr;
 			else if (elf().header.type() == Def::ET_EXEC)
 				return reinterpret_cast<void*>(offset);
 			else
@@ -2468,6 +3680,273 @@ class ELF : public ELF_Def::Structures<C> {
 		}
 	};
 
+	class SectionDirectory;
+
+	/*! \brief Sections of a given type (in the order of the section header table)
+	 * Following the type chains of a \ref SectionDirectory (if available), otherwise scanning the section header table
+	 */
+	class SectionsOfType {
+		/*! \brief ELF object */
+		const ELF<C> & _elf;
+
+		/*! \brief Section type */
+		const typename Def::shdr_type _type;
+
+		/*! \brief Section directory (or `nullptr`) */
+		const SectionDirectory * const _directory;
+
+		/*! \brief First section (index plus one, `0` if none) */
+		const uint16_t _first;
+
+	 public:
+		/*! \brief Iterator following the type chain */
+		class Iterator {
+			/*! \brief Sections */
+			const SectionsOfType & _list;
+
+			/*! \brief Current section index plus one (`0` indicates end) */
+			uint16_t _current;
+
+		 public:
+			/*! \brief Iterator constructor
+			 * \param list sections of type
+			 * \param current section index plus one
+			 */
+			Iterator(const SectionsOfType & list, uint16_t current)
+			  : _list{list}, _current{current} {}
+
+			/*! \brief Next section of the type */
+			Iterator & operator++() {
+				assert(_current != 0);
+				_current = _list.following(_current);
+				return *this;
+			}
+
+			/*! \brief Compare current iterator element */
+			bool operator==(const Iterator & other) const {
+				return _current == other._current;
+			}
+
+			/*! \brief Compare current iterator element */
+			bool operator!=(const Iterator & other) const {
+				return _current != other._current;
+			}
+
+			/*! \brief Get current section */
+			Section operator*() const {
+				return _list._elf.sections[_current - 1];
+			}
+
+			/*! \brief Index of current section */
+			uint16_t index() const {
+				return _current - 1;
+			}
+		};
+
+		/*! \brief Construct list of sections of a type
+		 * \param elf ELF object
+		 * \param type section type
+		 * \param directory section directory (or `nullptr` to scan the section header table)
+		 */
+		SectionsOfType(const ELF<C> & elf, typename Def::shdr_type type, const SectionDirectory * directory = nullptr)
+		  : _elf{elf}, _type{type}, _directory{directory != nullptr && directory->complete() ? directory : nullptr}, _first{following(0)} {}
+
+		/*! \brief Get Iterator for first section */
+		Iterator begin() const {
+			return Iterator{*this, _first};
+		}
+
+		/*! \brief Get Iterator indicating end of list */
+		Iterator end() const {
+			return Iterator{*this, 0};
+		}
+
+		/*! \brief Are there any sections of the type?
+		 * \return `false` if there is at least one section
+		 */
+		bool empty() const {
+			return _first == 0;
+		}
+
+		/*! \brief Number of sections of the type */
+		size_t count() const {
+			size_t n = 0;
+			for (uint16_t i = _first; i != 0; i = following(i))
+				n++;
+			return n;
+		}
+
+	 private:
+		/*! \brief Successor of a section
+		 * \param current section index plus one (`0` for the first one)
+		 * \return index plus one of the next section of the type (`0` if none)
+		 */
+		uint16_t following(uint16_t current) const {
+			if (_directory != nullptr) {
+				uint16_t i = current == 0 ? _directory->_first[SectionDirectory::slot(_type)] : _directory->_entry[current - 1].next;
+				// The last slot is shared by multiple types
+				while (i != 0 && _elf.sections[i - 1].type() != _type)
+					i = _directory->_entry[i - 1].next;
+				return i;
+			}
+			for (size_t i = current; i < _elf.sections.count(); i++)
+				if (_elf.sections[i].type() == _type)
+					return static_cast<uint16_t>(i + 1);
+			return 0;
+		}
+	};
+
+	/*! \brief Directory of the sections
+	 * Maps the (GNU) hash of the section names to the section index
+	 * and chains the sections of each type, hence neither name nor type lookups have to scan the section header table.
+	 * Built in a single pass over the section header table into caller-provided memory.
+	 * \note If the buffer is too small for all sections, lookups fall back to a linear search
+	 */
+	class SectionDirectory {
+		friend class SectionsOfType;
+
+	 public:
+		/*! \brief Entry for each section (including two hash buckets, hence the load factor is at most 50%) */
+		struct Entry {
+			/*! \brief Hash value of the section name */
+			uint32_t hash;
+			/*! \brief Next section (index plus one) in the same type slot (`0` if last) */
+			uint16_t next;
+			/*! \brief Hash buckets with section index plus one (`0` if empty) */
+			uint16_t bucket[2];
+		};
+
+		/*! \brief Number of entries required for the directory
+		 * \param elf ELF object
+		 * \return number of sections
+		 */
+		static size_t entries(const ELF<C> & elf) {
+			return elf.sections.count();
+		}
+
+		/*! \brief Build section directory
+		 * \param elf ELF object (must stay valid while this object is used)
+		 * \param buffer memory for the entries (must stay valid while this object is used)
+		 * \param size number of entries in buffer (should be at least \ref entries, otherwise the directory is not \ref complete)
+		 */
+		SectionDirectory(const ELF<C> & elf, Entry * buffer, size_t size)
+		  : _elf{elf}, _entry{buffer}, _count{elf.sections.count()}, _complete{_count <= size} {
+			if (!_complete)
+				return;
+
+			uint16_t last[slots];
+			for (size_t s = 0; s < slots; s++)
+				_first[s] = last[s] = 0;
+			for (size_t i = 0; i < _count; i++)
+				_entry[i].bucket[0] = _entry[i].bucket[1] = 0;
+
+			const bool names = _elf.has_section_names();
+			for (size_t i = 0; i < _count; i++) {
+				const auto section = _elf.sections[i];
+				// Chain by type
+				const size_t s = slot(section.type());
+				_entry[i].next = 0;
+				if (last[s] == 0)
+					_first[s] = static_cast<uint16_t>(i + 1);
+				else
+					_entry[last[s] - 1].next = static_cast<uint16_t>(i + 1);
+				last[s] = static_cast<uint16_t>(i + 1);
+
+				// Insert name (the null section has none), keeping the first of duplicates in front
+				_entry[i].hash = 0;
+				if (names && i != Def::SHN_UNDEF) {
+					_entry[i].hash = static_cast<uint32_t>(ELF_Def::gnuhash(section.name()));
+					size_t b = _entry[i].hash % (2 * _count);
+					while (bucket(b) != 0)
+						b = (b + 1) % (2 * _count);
+					bucket(b) = static_cast<uint16_t>(i + 1);
+				}
+			}
+		}
+
+		/*! \brief Are all sections covered by the directory?
+		 * \return `false` if the buffer was too small
+		 */
+		bool complete() const {
+			return _complete;
+		}
+
+		/*! \brief Find section by name
+		 * \param name section name (e.g. `.gnu_debuglink`)
+		 * \return index of the first section with the name or `SHN_UNDEF` if not found
+		 */
+		uint16_t find(const char * name) const {
+			if (!_complete)
+				return _elf.find_section(name);
+			if (_count > 0) {
+				const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(name));
+				for (size_t b = hash_value % (2 * _count); bucket(b) != 0; b = (b + 1) % (2 * _count)) {
+					const uint16_t i = bucket(b) - 1;
+					if (_entry[i].hash == hash_value && strcmp(_elf.sections[i].name(), name) == 0)
+						return i;
+				}
+			}
+			return Def::SHN_UNDEF;
+		}
+
+		/*! \brief Sections of a given type
+		 * \param type section type
+		 * \return iterable list of the sections
+		 */
+		SectionsOfType sections_of_type(typename Def::shdr_type type) const {
+			return SectionsOfType{_elf, type, this};
+		}
+
+		/*! \brief Get symbol table (following the `SHT_SYMTAB` type chain)
+		 * \return Symbol Table (empty if there is none)
+		 */
+		SymbolTable symbol_table() const {
+			for (const auto &s : sections_of_type(Def::SHT_SYMTAB))
+				return s.get_symbol_table();
+			return SymbolTable{_elf};
+		}
+
+	 private:
+		/*! \brief Number of type slots: standard range, GNU range (`SHT_GNU_ATTRIBUTES` to `SHT_GNU_VERSYM`) and all others */
+		static const size_t slots = Def::SHT_NUM + (Def::SHT_GNU_VERSYM - Def::SHT_GNU_ATTRIBUTES + 1) + 1;
+
+		/*! \brief ELF object */
+		const ELF<C> & _elf;
+
+		/*! \brief Entries (indexed by section index) */
+		Entry * const _entry;
+
+		/*! \brief Number of sections */
+		const size_t _count;
+
+		/*! \brief All sections are covered by the directory */
+		const bool _complete;
+
+		/*! \brief First section (index plus one) of each type slot (`0` if none) */
+		uint16_t _first[slots];
+
+		/*! \brief Hash bucket
+		 * \param b bucket index (less than twice the number of sections)
+		 * \return reference to bucket
+		 */
+		uint16_t & bucket(size_t b) const {
+			return _entry[b / 2].bucket[b % 2];
+		}
+
+		/*! \brief Slot of a section type
+		 * \param type section type
+		 * \return slot index (the last slot is shared by all other types)
+		 */
+		static size_t slot(typename Def::shdr_type type) {
+			if (static_cast<size_t>(type) < Def::SHT_NUM)
+				return static_cast<size_t>(type);
+			else if (type >= Def::SHT_GNU_ATTRIBUTES && type <= Def::SHT_GNU_VERSYM)
+				return Def::SHT_NUM + static_cast<size_t>(type - Def::SHT_GNU_ATTRIBUTES);
+			else
+				return slots - 1;
+		}
+	};
+
 
 	/*! \brief Header */
 	const Header &header;
@@ -2565,6 +4044,16 @@ class ELF : public ELF_Def::Structures<C> {
 		return DynamicTable{*this};
 	}
 
+	/*! \brief Access dynamic section (file not mapped according to the segments) using an address translation index
+	 * \param loads address translation index of this ELF (must stay valid while the table is used)
+	 */
+	DynamicTable dynamic(const LoadMap & loads) const {
+		for (const auto &s : segments)
+			if (s.type() == Def::PT_DYNAMIC)
+				return s.get_dynamic_table(loads);
+		return DynamicTable{*this};
+	}
+
 	/*! \brief Interpreter (dynamic linker) */
 	const char * interpreter() const {
 		for (const auto &s : segments)
@@ -2575,15 +4064,37 @@ class ELF : public ELF_Def::Structures<C> {
 
 	/*! \brief Get symbol table
 	 * \note a valid ELF file should not contain more than one symbol table!
+	 * \note Scans the section header table -- use \ref SectionDirectory::symbol_table for repeated lookups
 	 * \return Symbol Table
 	 */
 	SymbolTable symbol_table() const {
-		for (const auto &s : sections)
-			if (s.type() == Def::SHT_SYMTAB)
-				return s.get_symbol_table();
+		for (const auto &s : sections_of_type(Def::SHT_SYMTAB))
+			return s.get_symbol_table();
 		return SymbolTable{*this};
 	}
 
+	/*! \brief Find section by name
+	 * \note Scans the section header table -- use a \ref SectionDirectory for repeated lookups
+	 * \param name section name (e.g. `.gnu_debuglink`)
+	 * \return index of the first section with the name or `SHN_UNDEF` if not found
+	 */
+	uint16_t find_section(const char * name) const {
+		if (has_section_names())
+			for (size_t i = 1; i < sections.count(); i++)
+				if (strcmp(sections[i].name(), name) == 0)
+					return static_cast<uint16_t>(i);
+		return Def::SHN_UNDEF;
+	}
+
+	/*! \brief Sections of a given type
+	 * \note Scans the section header table -- use a \ref SectionDirectory for repeated lookups
+	 * \param type section type
+	 * \return iterable list of the sections
+	 */
+	SectionsOfType sections_of_type(typename Def::shdr_type type) const {
+		return SectionsOfType{*this, type};
+	}
+
 	/*! \brief Get symbol
 	 * \param section symbol table section
 	 * \param index index of symbol in table
@@ -2673,6 +4184,12 @@ class ELF : public ELF_Def::Structures<C> {
 
 		return size;
 	}
+
+ private:
+	/*! \brief Does the file contain a valid section header string table? */
+	bool has_section_names() const {
+		return header.e_shstrndx != Def::SHN_UNDEF && header.e_shstrndx < sections.count();
+	}
 };
 
 // Declare types for fast access
@@ -0,0 +1,195 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+#include "elf_def/sort.hpp"
+
+/*! \brief Address to symbol index (reverse lookup)
+ * Sorted interval table of all defined functions and objects with non-zero size,
+ * built once into caller-provided memory.
+ * Each entry additionally links to the nearest preceding entry which ends after its start,
+ * hence a lookup only visits the chain of enclosing (or overlapping) symbols
+ * -- its length is bounded by the nesting depth, which is small for usual symbol tables.
+ * \note Addresses are virtual addresses as specified in the ELF file (without load bias)
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class AddressIndex : private ELF_Def::Constants {
+	using Symbol = typename ELF<C>::Symbol;
+	using Symbols = typename ELF<C>::template Array<Symbol>;
+
+ public:
+	/*! \brief Interval of a symbol */
+	struct Entry {
+		/*! \brief Start address of symbol */
+		uintptr_t start;
+		/*! \brief End address of symbol (exclusive) */
+		uintptr_t end;
+		/*! \brief Index of symbol in the symbol array */
+		uint32_t index;
+		/*! \brief Position (plus one) of the nearest preceding entry ending after the start of this entry (`0` if none) */
+		uint32_t enclosing;
+	};
+
+	/*! \brief Underlying symbols */
+	const Symbols symbols;
+
+	/*! \brief Check if a symbol is considered in the address index
+	 * \param sym symbol
+	 * \return `true` for defined functions and objects with non-zero size
+	 */
+	static bool eligible(const Symbol & sym) {
+		switch (sym.type()) {
+			case STT_FUNC:
+			case STT_GNU_IFUNC:
+			case STT_OBJECT:
+				return !sym.undefined() && sym.size() > 0;
+			default:
+				return false;
+		}
+	}
+
+	/*! \brief Number of entries required for an address index
+	 * \param symbols symbol array
+	 * \return number of eligible symbols
+	 */
+	static size_t entries(const Symbols & symbols) {
+		size_t n = 0;
+		for (const auto & sym : symbols)
+			if (eligible(sym))
+				n++;
+		return n;
+	}
+
+	/*! \brief Build address index
+	 * \param symbols symbol array (e.g. from `Section::get_symbols()` or `DynamicTable::get_symbols()`)
+	 * \param buffer memory for the index entries (must stay valid while this object is used)
+	 * \param size number of entries in buffer (should be at least \ref entries, otherwise only the first eligible symbols are indexed)
+	 */
+	AddressIndex(const Symbols & symbols, Entry * buffer, size_t size) : symbols(symbols), _entry(buffer), _count(0), _complete(true) {
+		const size_t n = symbols.count();
+		for (size_t i = 0; i < n; i++) {
+			const auto sym = symbols[i];
+			if (eligible(sym)) {
+				if (_count >= size) {
+					_complete = false;
+					break;
+				}
+				_entry[_count++] = { sym.value(), sym.value() + sym.size(), static_cast<uint32_t>(i), 0 };
+			}
+		}
+
+		// Sort by start address, enclosing intervals first and lower symbol indices last
+		ELF_Def::sort(_entry, _count, [](const Entry & a, const Entry & b) {
+			if (a.start != b.start)
+				return a.start < b.start;
+			else if (a.end != b.end)
+				return a.end > b.end;
+			else
+				return a.index > b.index;
+		});
+
+		// Entries skipped by following the links of the predecessor end before its start (and hence before ours)
+		for (size_t i = 1; i < _count; i++) {
+			size_t e = i;
+			while (e > 0 && _entry[e - 1].end <= _entry[i].start)
+				e = _entry[e - 1].enclosing;
+			_entry[i].enclosing = static_cast<uint32_t>(e);
+		}
+	}
+
+	/*! \brief Number of entries in index */
+	size_t count() const {
+		return _count;
+	}
+
+	/*! \brief Have all eligible symbols been indexed?
+	 * \return `false` if the buffer was too small
+	 */
+	bool complete() const {
+		return _complete;
+	}
+
+	/*! \brief Find symbol containing address
+	 * If multiple symbols contain the address, the one with the highest start address
+	 * (and, if still ambiguous, with the smallest size and the lowest symbol index) is returned.
+	 * \param address virtual address
+	 * \return index of symbol in the symbol array or STN_UNDEF if none
+	 */
+	uint32_t index(uintptr_t address) const {
+		return containing(upper_bound(address), address);
+	}
+
+	/*! \brief Find symbol containing address
+	 * \param address virtual address
+	 * \return Symbol (STN_UNDEF if none)
+	 */
+	Symbol operator[](uintptr_t address) const {
+		return symbols[index(address)];
+	}
+
+	/*! \brief Find symbols containing each of the addresses
+	 * For ascending sorted addresses the index is traversed in a single merge pass,
+	 * unsorted addresses fall back to a binary search.
+	 * \param addresses array of virtual addresses (preferably sorted in ascending order)
+	 * \param n number of addresses
+	 * \param results array (with at least `n` elements) for the index of each symbol or STN_UNDEF
+	 */
+	void index_many(const uintptr_t * addresses, size_t n, uint32_t * results) const {
+		size_t pos = 0;
+		for (size_t i = 0; i < n; i++) {
+			const uintptr_t address = addresses[i];
+			if (i > 0 && address < addresses[i - 1])
+				pos = upper_bound(address);
+			else
+				while (pos < _count && _entry[pos].start <= address)
+					pos++;
+			results[i] = containing(pos, address);
+		}
+	}
+
+ private:
+	/*! \brief Entries sorted by start address */
+	Entry * const _entry;
+
+	/*! \brief Number of entries */
+	size_t _count;
+
+	/*! \brief All eligible symbols are indexed */
+	bool _complete;
+
+	/*! \brief Get position of first entry starting after the address
+	 * \param address virtual address
+	 * \return position in entry array (or count if none)
+	 */
+	size_t upper_bound(uintptr_t address) const {
+		size_t pos = 0;
+		for (size_t len = _count; len > 0;) {
+			const size_t half = len / 2;
+			if (_entry[pos + half].start <= address) {
+				pos += half + 1;
+				len -= half + 1;
+			} else {
+				len = half;
+			}
+		}
+		return pos;
+	}
+
+	/*! \brief Search backwards for entry containing address
+	 * Follows the links to preceding entries ending after the start of the current one,
+	 * since all entries in between end before the address.
+	 * \param pos position of first entry starting after the address
+	 * \param address virtual address
+	 * \return index of symbol in the symbol array or STN_UNDEF if none
+	 */
+	uint32_t containing(size_t pos, uintptr_t address) const {
+		for (; pos > 0; pos = _entry[pos - 1].enclosing)
+			if (_entry[pos - 1].end > address)
+				return _entry[pos - 1].index;
+		return STN_UNDEF;
+	}
+};
@@ -0,0 +1,31 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+namespace ELF_Def {
+
+/*! \brief Wrapper for Builtins
+ * with overloaded parameter for different data types */
+struct Builtin {
+	// Count trailing zeros
+	static int ctz(unsigned int value) { return __builtin_ctz(value); }
+	static int ctz(unsigned long value) { return __builtin_ctzl(value); }
+	static int ctz(unsigned long long value) { return __builtin_ctzll(value); }
+
+	// Count leading zeros
+	static int clz(unsigned int value) { return __builtin_clz(value); }
+	static int clz(unsigned long value) { return __builtin_clzl(value); }
+	static int clz(unsigned long long value) { return __builtin_clzll(value); }
+
+	// Population count (number of 1s)
+	static int popcount(unsigned int value) { return __builtin_popcount(value); }
+	static int popcount(unsigned long value) { return __builtin_popcountl(value); }
+	static int popcount(unsigned long long value) { return __builtin_popcountll(value); }
+
+	// Prefetch memory (read access)
+	static void prefetch(const void * addr) { __builtin_prefetch(addr); }
+};
+
+}  // namespace ELF_Def
@@ -25,7 +25,7 @@ struct GnuHash_header {
  * \param s string to hash
  * \return hash value
  */
-static inline uint32_t hash(const char *s) {
+static inline constexpr uint32_t hash(const char *s) {
 	uint32_t h = 0;
 	if (s != nullptr) {
 		for (; *s != 0; s++) {
@@ -39,11 +39,31 @@ static inline uint32_t hash(const char *s) {
 	return h;
 }
 
+/*! \brief ELF string hash
+ * \param s string to hash
+ * \param length reference to store the length of the string
+ * \return hash value
+ */
+static inline constexpr uint32_t hash(const char *s, uint32_t & length) {
+	uint32_t h = 0;
+	length = 0;
+	if (s != nullptr) {
+		for (; s[length] != 0; length++) {
+			h = (h << 4) + s[length];
+			const uint32_t g = h & 0xf0000000;
+			if (g != 0)
+				h ^= g >> 24;
+			h &= ~g;
+		}
+	}
+	return h;
+}
+
 /*! \brief GNU string hash
  * \param s string to hash
  * \return hash value
  */
-static inline uint_fast32_t gnuhash(const char *s) {
+static inline constexpr uint_fast32_t gnuhash(const char *s) {
 	if (s == nullptr)
 		return 0;
 	uint_fast32_t h = 5381;
@@ -52,4 +72,190 @@ static inline uint_fast32_t gnuhash(const char *s) {
 	return h & 0xffffffff;
 }
 
+/*! \brief GNU string hash
+ * \param s string to hash
+ * \param length reference to store the length of the string
+ * \return hash value
+ */
+static inline constexpr uint_fast32_t gnuhash(const char *s, uint32_t & length) {
+	length = 0;
+	if (s == nullptr)
+		return 0;
+	uint_fast32_t h = 5381;
+	for (unsigned char c = s[0]; c != '\0'; c = s[++length])
+		h = h * 33 + c;
+	return h & 0xffffffff;
+}
+
+/*! \brief Symbol name with precomputed length and hash values
+ * Declared `constexpr` (e.g. `constexpr SymbolKey key("_start");`), the hashes are calculated at compile time
+ * and a lookup using this key requires no hashing at all.
+ */
+struct SymbolKey {
+	/*! \brief Symbol name */
+	const char * name = nullptr;
+	/*! \brief Length of symbol name (without terminating null byte) */
+	uint32_t length = 0;
+	/*! \brief ELF string hash of symbol name */
+	uint32_t hash = 0;
+	/*! \brief GNU string hash of symbol name */
+	uint32_t gnuhash = 0;
+
+	/*! \brief Create key
+	 * \param name symbol name
+	 */
+	constexpr SymbolKey(const char * name) : name(name) {  // NOLINT
+		this->hash = ELF_Def::hash(name, length);
+		this->gnuhash = static_cast<uint32_t>(ELF_Def::gnuhash(name));
+	}
+};
+
+#if defined(__SSE2__) && !defined(USE_DLH)
+/*! \brief Number of strings hashed in lockstep by `hash_bulk`
+ * (using the vector extension of the compiler, which maps to SSE2/AVX2/AVX-512 depending on the target)
+ */
+#ifdef __AVX512F__
+static const size_t hash_lanes = 16;
+#else
+static const size_t hash_lanes = 8;
+#endif
+
+/*! \brief Minimum average string length for hashing in lockstep
+ * (for shorter strings, e.g. C symbol names, refilling the lanes costs more than the scalar variant)
+ */
+static const size_t hash_lockstep_length = 40;
+
+/*! \brief Number of strings per chunk in `hash_bulk`, the first `hash_lanes` strings of each chunk are hashed scalar to sample their length */
+static const size_t hash_chunk = 8 * hash_lanes;
+
+/*! \brief Vector of hash values (one per lane) */
+typedef uint32_t hash_vector_t __attribute__((vector_size(hash_lanes * sizeof(uint32_t))));
+
+/*! \brief ELF hash strings in lockstep, each lane is refilled with the next string as soon as its current string is finished
+ * \param s array of strings to hash
+ * \param n number of strings (at least `hash_lanes`)
+ * \param hashes array to store the hash values
+ * \param lengths array to store the length of the strings (or `nullptr`)
+ */
+static inline void hash_lanes_lockstep(const char * const * s, size_t n, uint32_t * hashes, uint32_t * lengths) {
+	const char * p[hash_lanes];
+	size_t idx[hash_lanes];
+	hash_vector_t h = hash_vector_t{};
+	hash_vector_t len = hash_vector_t{};
+	for (size_t l = 0; l < hash_lanes; l++) {
+		idx[l] = l;
+		p[l] = s[l] == nullptr ? "" : s[l];
+	}
+	size_t next = hash_lanes;
+
+	while (true) {
+		// Gather next character of each lane (keeping the character promotion of the scalar variant)
+		hash_vector_t c;
+		bool refill = false;
+		for (size_t l = 0; l < hash_lanes; l++) {
+			c[l] = static_cast<uint32_t>(*p[l]);
+			refill |= c[l] == 0;
+		}
+
+		if (refill) {
+			// Store finished lanes and assign the next strings
+			for (size_t l = 0; l < hash_lanes; l++)
+				while (c[l] == 0) {
+					hashes[idx[l]] = s[idx[l]] == nullptr ? 0 : h[l];
+					if (lengths != nullptr)
+						lengths[idx[l]] = len[l];
+					if (next >= n) {
+						// No more strings: finish the remaining lanes using the scalar variant
+						for (size_t r = 0; r < hash_lanes; r++)
+							if (r != l) {
+								uint32_t hr = h[r];
+								uint32_t lr = len[r];
+								for (const char * q = p[r]; *q != '\0'; q++, lr++) {
+									hr = (hr << 4) + *q;
+									const uint32_t g = hr & 0xf0000000;
+									if (g != 0)
+										hr ^= g >> 24;
+									hr &= ~g;
+								}
+								hashes[idx[r]] = hr;
+								if (lengths != nullptr)
+									lengths[idx[r]] = lr;
+							}
+						return;
+					}
+					idx[l] = next++;
+					p[l] = s[idx[l]] == nullptr ? "" : s[idx[l]];
+					h[l] = 0;
+					len[l] = 0;
+					c[l] = static_cast<uint32_t>(*p[l]);
+				}
+		}
+
+		// All lanes are active
+		h = (h << 4) + c;
+		const hash_vector_t g = h & 0xf0000000;
+		h ^= g >> 24;
+		h &= ~g;
+		len += 1;
+		for (size_t l = 0; l < hash_lanes; l++)
+			p[l]++;
+	}
+}
+#endif
+
+/*! \brief ELF string hash of multiple strings
+ * \note Long strings (e.g. mangled C++ symbol names) are hashed in lockstep using SIMD (if available),
+ *       the choice is made per chunk based on the length of its first strings
+ * \param s array of strings to hash
+ * \param n number of strings
+ * \param hashes array (with at least `n` elements) to store the hash values
+ * \param lengths array (with at least `n` elements) to store the length of the strings (or `nullptr`)
+ */
+static inline void hash_bulk(const char * const * s, size_t n, uint32_t * hashes, uint32_t * lengths = nullptr) {
+#if defined(__SSE2__) && !defined(USE_DLH)
+	for (size_t offset = 0; offset < n; offset += hash_chunk) {
+		const size_t chunk = n - offset < hash_chunk ? n - offset : hash_chunk;
+		const size_t sample = chunk < hash_lanes ? chunk : hash_lanes;
+		size_t total = 0;
+		for (uint32_t length, i = 0; i < sample; i++) {
+			hashes[offset + i] = hash(s[offset + i], length);
+			if (lengths != nullptr)
+				lengths[offset + i] = length;
+			total += length;
+		}
+		if (chunk - sample >= hash_lanes && total >= sample * hash_lockstep_length) {
+			hash_lanes_lockstep(s + offset + sample, chunk - sample, hashes + offset + sample, lengths == nullptr ? nullptr : lengths + offset + sample);
+		} else {
+			for (uint32_t length, i = static_cast<uint32_t>(sample); i < chunk; i++) {
+				hashes[offset + i] = hash(s[offset + i], length);
+				if (lengths != nullptr)
+					lengths[offset + i] = length;
+			}
+		}
+	}
+#else
+	for (uint32_t length, i = 0; i < n; i++) {
+		hashes[i] = hash(s[i], length);
+		if (lengths != nullptr)
+			lengths[i] = length;
+	}
+#endif
+}
+
+/*! \brief GNU string hash of multiple strings
+ * \note In contrast to the ELF string hash, the GNU hash is not computed in lockstep:
+ *       Its short dependency chain makes the scalar variant faster than gathering the characters into vector lanes.
+ * \param s array of strings to hash
+ * \param n number of strings
+ * \param hashes array (with at least `n` elements) to store the hash values
+ * \param lengths array (with at least `n` elements) to store the length of the strings (or `nullptr`)
+ */
+static inline void gnuhash_bulk(const char * const * s, size_t n, uint32_t * hashes, uint32_t * lengths = nullptr) {
+	for (uint32_t length, i = 0; i < n; i++) {
+		hashes[i] = gnuhash(s[i], length);
+		if (lengths != nullptr)
+			lengths[i] = length;
+	}
+}
+
 }  // namespace ELF_Def
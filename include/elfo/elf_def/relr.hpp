@@ -0,0 +1,94 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "builtin.hpp"
+#include "const.hpp"
+#include "types.hpp"
+
+#if defined(__AVX512F__) && !defined(USE_DLH)
+#include <immintrin.h>
+#endif
+
+namespace ELF_Def {
+
+/*! \brief Decode a bitmap entry of relative relocations (`DT_RELR`)
+ * Expands all set bits (except the marker bit 0) into offsets:
+ * Bit `i` represents the word at `where + (i - 1) * sizeof(T)`.
+ * With AVX-512, eight bits are expanded at once (compress store), otherwise one bit per iteration.
+ * \tparam T word type (of the elf class)
+ * \param where offset of the first word represented by the bitmap
+ * \param bitmap bitmap entry
+ * \param offsets array for the decoded offsets (with at least `8 * sizeof(T) - 1` elements)
+ * \return number of decoded offsets
+ */
+template<typename T>
+static inline size_t relr_bitmap(uintptr_t where, T bitmap, uintptr_t * offsets) {
+	bitmap >>= 1;
+	size_t n = 0;
+#if defined(__AVX512F__) && !defined(USE_DLH)
+	if (sizeof(uintptr_t) == sizeof(long long)) {
+		const long long w = sizeof(T);
+		const __m512i step = _mm512_set1_epi64(8 * w);
+		__m512i v = _mm512_add_epi64(_mm512_set1_epi64(static_cast<long long>(where)), _mm512_setr_epi64(0, w, 2 * w, 3 * w, 4 * w, 5 * w, 6 * w, 7 * w));
+		for (; bitmap != 0; bitmap >>= 8) {
+			const __mmask8 mask = static_cast<__mmask8>(bitmap & 0xff);
+			_mm512_mask_compressstoreu_epi64(offsets + n, mask, v);
+			n += Builtin::popcount(static_cast<unsigned int>(mask));
+			v = _mm512_add_epi64(v, step);
+		}
+		return n;
+	}
+#endif
+	for (; bitmap != 0; bitmap &= bitmap - 1)
+		offsets[n++] = where + Builtin::ctz(bitmap) * sizeof(T);
+	return n;
+}
+
+/*! \brief Encode offsets as relative relocations (`DT_RELR`)
+ * Greedy encoding (like the linkers do), resulting in the minimal number of entries:
+ * An offset not covered by the preceding entries starts with an address entry,
+ * followed by bitmap entries (each covering the next `8 * sizeof(T) - 1` words) as long as they are not empty.
+ * Offsets which cannot be encoded in a bitmap (not a multiple of the word size apart) get a new address entry.
+ * \tparam T word type (of the elf class)
+ * \param offsets ascending sorted, unique and even offsets
+ * \param n number of offsets
+ * \param relr array for the encoded entries (or `nullptr` to only count the entries)
+ * \param size number of elements in relr array (entries beyond are not stored)
+ * \return number of entries required for the encoding
+ */
+template<typename T>
+static inline size_t relr_encode(const uintptr_t * offsets, size_t n, T * relr = nullptr, size_t size = 0) {
+	const uintptr_t bits = 8 * sizeof(T) - 1;
+	size_t entries = 0;
+	for (size_t i = 0; i < n;) {
+		// Address entry
+		uintptr_t where = offsets[i++];
+		if (relr != nullptr && entries < size)
+			relr[entries] = static_cast<T>(where);
+		entries++;
+		where += sizeof(T);
+
+		// Bitmap entries
+		while (i < n) {
+			T bitmap = 0;
+			for (; i < n; i++) {
+				const uintptr_t delta = offsets[i] - where;
+				if (offsets[i] < where || delta >= bits * sizeof(T) || delta % sizeof(T) != 0)
+					break;
+				bitmap |= static_cast<T>(1) << (delta / sizeof(T));
+			}
+			if (bitmap == 0)
+				break;
+			if (relr != nullptr && entries < size)
+				relr[entries] = static_cast<T>((bitmap << 1) | 1);
+			entries++;
+			where += bits * sizeof(T);
+		}
+	}
+	return entries;
+}
+
+}  // namespace ELF_Def
@@ -0,0 +1,49 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "const.hpp"
+#include "types.hpp"
+
+namespace ELF_Def {
+
+/*! \brief Sort array in place (heapsort, hence without additional memory)
+ * \tparam T element type
+ * \tparam LESS strict weak ordering predicate
+ * \param data array of elements
+ * \param n number of elements
+ * \param less predicate returning `true` if the first argument is ordered before the second one
+ */
+template<typename T, typename LESS>
+static inline void sort(T * data, size_t n, LESS less) {
+	// Move element down the heap
+	auto sift_down = [&](size_t root, size_t end) {
+		while (2 * root + 1 < end) {
+			size_t child = 2 * root + 1;
+			if (child + 1 < end && less(data[child], data[child + 1]))
+				child++;
+			if (!less(data[root], data[child]))
+				return;
+			T tmp = data[root];
+			data[root] = data[child];
+			data[child] = tmp;
+			root = child;
+		}
+	};
+
+	// Build max heap
+	for (size_t i = n / 2; i > 0; i--)
+		sift_down(i - 1, n);
+
+	// Move maximum to the end
+	for (size_t end = n; end > 1; end--) {
+		T tmp = data[0];
+		data[0] = data[end - 1];
+		data[end - 1] = tmp;
+		sift_down(0, end - 1);
+	}
+}
+
+}  // namespace ELF_Def
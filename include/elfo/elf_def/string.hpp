@@ -0,0 +1,61 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "const.hpp"
+#include "types.hpp"
+
+namespace ELF_Def {
+
+/*! \brief Length of string
+ * \param s string (or `nullptr`)
+ * \return number of characters (without terminating null byte)
+ */
+static inline constexpr uint32_t length(const char * s) {
+	uint32_t l = 0;
+	if (s != nullptr)
+		while (s[l] != '\0')
+			l++;
+	return l;
+}
+
+/*! \brief Read unaligned value
+ * \tparam T type of value
+ * \param p memory address
+ * \return value
+ */
+template<typename T>
+static inline T load(const char * p) {
+	T v;
+	__builtin_memcpy(&v, p, sizeof(T));
+	return v;
+}
+
+/*! \brief Compare memory of given length
+ * Word-wise (unaligned) comparison, the tail is compared using an overlapping word.
+ * No byte beyond `length` is accessed.
+ * \param a first string
+ * \param b second string
+ * \param length number of bytes to compare
+ * \return `true` if both are equal
+ */
+static inline bool equal(const char * a, const char * b, size_t length) {
+	if (length >= sizeof(uint64_t)) {
+		for (size_t i = 0; i + sizeof(uint64_t) < length; i += sizeof(uint64_t))
+			if (load<uint64_t>(a + i) != load<uint64_t>(b + i))
+				return false;
+		return load<uint64_t>(a + length - sizeof(uint64_t)) == load<uint64_t>(b + length - sizeof(uint64_t));
+	} else if (length >= sizeof(uint32_t)) {
+		return load<uint32_t>(a) == load<uint32_t>(b)
+		    && load<uint32_t>(a + length - sizeof(uint32_t)) == load<uint32_t>(b + length - sizeof(uint32_t));
+	} else {
+		for (size_t i = 0; i < length; i++)
+			if (a[i] != b[i])
+				return false;
+		return true;
+	}
+}
+
+}  // namespace ELF_Def
@@ -0,0 +1,267 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf_rel.hpp"
+#include "elf_def/sort.hpp"
+
+/*! \brief Pages dirtied by relocations
+ * Writing a relocation target in a (private) file mapping creates a copy of the page,
+ * which is no longer shared with other processes using the same object.
+ * This analysis counts the distinct pages written by each class of relocations
+ * for each loadable segment (using a bitmap in caller-provided memory)
+ * and reports the symbol relocations dirtying pages which would otherwise stay clean.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class DirtyPages : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using Relocation = typename ELF<C>::Relocation;
+	using Relocations = typename ELF<C>::template Array<Relocation>;
+
+	/*! \brief Number of bits in a bitmap word */
+	static const size_t bits = 64;
+
+ public:
+	/*! \brief Class of relocation */
+	enum Class {
+		RELATIVE,  ///< Relative relocations (including `DT_RELR`), not depending on any symbol
+		SYMBOL,    ///< Other relocations in the dynamic relocation table (usually referencing a symbol)
+		PLT,       ///< Relocations for the procedure linkage table
+		CLASSES    ///< Number of classes
+	};
+
+	/*! \brief Dirty pages of a loadable segment */
+	struct Segment {
+		/*! \brief Virtual address of the segment */
+		uintptr_t virt_addr;
+		/*! \brief Size of the segment in memory */
+		size_t virt_size;
+		/*! \brief Number of pages of the segment */
+		size_t pages;
+		/*! \brief Number of distinct pages dirtied by each class */
+		size_t dirty[CLASSES];
+		/*! \brief Number of distinct pages dirtied by any relocation */
+		size_t dirty_total;
+		/*! \brief Number of relocations of each class */
+		size_t relocations[CLASSES];
+		/*! \brief First bitmap word of the segment */
+		size_t bitmap;
+	};
+
+	/*! \brief Size of a page */
+	const size_t page_size;
+
+	/*! \brief Number of loadable segments
+	 * \param elf ELF object
+	 * \return number of `PT_LOAD` segments
+	 */
+	static size_t segments(const ELF<C> & elf) {
+		size_t n = 0;
+		for (const auto & s : elf.segments)
+			if (s.type() == PT_LOAD)
+				n++;
+		return n;
+	}
+
+	/*! \brief Size of bitmap for the analysis
+	 * \param elf ELF object
+	 * \param page_size size of a page
+	 * \return number of bitmap words
+	 */
+	static size_t bitmap_size(const ELF<C> & elf, size_t page_size = 4096) {
+		size_t words = 0;
+		for (const auto & s : elf.segments)
+			if (s.type() == PT_LOAD)
+				words += CLASSES * ((pages(s.virt_addr(), s.virt_size(), page_size) + bits - 1) / bits);
+		return words;
+	}
+
+	/*! \brief Analyze the dynamic relocations of an object
+	 * \param elf ELF object
+	 * \param segments array for the results of each loadable segment (with at least \ref segments elements)
+	 * \param count number of elements in segments array
+	 * \param bitmap memory for the bitmap (must stay valid while this object is used)
+	 * \param size number of words in bitmap (at least \ref bitmap_size)
+	 * \param page_size size of a page
+	 */
+	DirtyPages(const ELF<C> & elf, Segment * segments, size_t count, uint64_t * bitmap, size_t size, size_t page_size = 4096)
+	  : page_size(page_size), machine(elf.header.machine()), _segment(segments), _count(0), _bitmap(bitmap) {
+		assert(page_size > 0 && size >= bitmap_size(elf, page_size));
+		(void) size;
+
+		size_t words = 0;
+		for (const auto & s : elf.segments)
+			if (s.type() == PT_LOAD && _count < count) {
+				Segment & segment = _segment[_count++];
+				segment.virt_addr = s.virt_addr();
+				segment.virt_size = s.virt_size();
+				segment.pages = pages(s.virt_addr(), s.virt_size(), page_size);
+				segment.bitmap = words;
+				for (size_t c = 0; c < CLASSES; c++)
+					segment.relocations[c] = 0;
+				words += CLASSES * ((segment.pages + bits - 1) / bits);
+			}
+		for (size_t i = 0; i < words; i++)
+			_bitmap[i] = 0;
+
+		const auto dynamic = elf.dynamic();
+		if (!dynamic.empty()) {
+			for (const auto & entry : dynamic.get_relocations())
+				mark(entry.offset(), Relocator<Relocation>::is_relative(entry.type(), machine) ? RELATIVE : SYMBOL);
+			for (const auto & entry : dynamic.get_relocations_plt())
+				mark(entry.offset(), PLT);
+			for (const auto & entry : dynamic.get_relative_relocations())
+				mark(entry.offset(), RELATIVE);
+		}
+
+		// Count distinct pages
+		for (size_t i = 0; i < _count; i++) {
+			Segment & segment = _segment[i];
+			const size_t segment_words = (segment.pages + bits - 1) / bits;
+			segment.dirty_total = 0;
+			for (size_t c = 0; c < CLASSES; c++)
+				segment.dirty[c] = 0;
+			for (size_t w = 0; w < segment_words; w++) {
+				uint64_t any = 0;
+				for (size_t c = 0; c < CLASSES; c++) {
+					const uint64_t word = _bitmap[segment.bitmap + c * segment_words + w];
+					segment.dirty[c] += ELF_Def::Builtin::popcount(word);
+					any |= word;
+				}
+				segment.dirty_total += ELF_Def::Builtin::popcount(any);
+			}
+		}
+	}
+
+	/*! \brief Number of analyzed segments */
+	size_t count() const {
+		return _count;
+	}
+
+	/*! \brief Get analysis of a loadable segment
+	 * \param i index of loadable segment
+	 * \return Segment analysis
+	 */
+	const Segment & segment(size_t i) const {
+		assert(i < _count);
+		return _segment[i];
+	}
+
+	/*! \brief Check if the page of an address is dirtied by a class of relocations
+	 * \param vaddr virtual address
+	 * \param c class of relocations
+	 * \return `true` if dirtied
+	 */
+	bool dirty(uintptr_t vaddr, Class c) const {
+		size_t word;
+		uint64_t mask;
+		return locate(vaddr, c, word, mask) && (_bitmap[word] & mask) != 0;
+	}
+
+	/*! \brief Report symbol relocations (including PLT) dirtying pages
+	 * \param relocations relocation table (e.g. `DynamicTable::get_relocations()` or `get_relocations_plt()`)
+	 * \param callback function called as `void callback(const Relocation & entry, bool exclusive)`
+	 *                 for each symbol relocation, with `exclusive` if its page is not dirtied by any relative relocation
+	 * \return number of symbol relocations with exclusive pages
+	 */
+	template<typename CALLBACK>
+	size_t symbols(const Relocations & relocations, CALLBACK callback) const {
+		size_t exclusive = 0;
+		for (const auto & entry : relocations)
+			if (entry.symbol_index() != STN_UNDEF && !Relocator<Relocation>::is_relative(entry.type(), machine)) {
+				const bool e = !dirty(entry.offset(), RELATIVE);
+				callback(entry, e);
+				if (e)
+					exclusive++;
+			}
+		return exclusive;
+	}
+
+	/*! \brief Order of the relocations by their target (and hence by page)
+	 * For \ref BatchRelocator::apply with given order
+	 * \param relocations relocation table
+	 * \param order array for the permutation of the relocation indices (with `relocations.count()` elements)
+	 */
+	static void page_order(const Relocations & relocations, uint32_t * order) {
+		const size_t n = relocations.count();
+		for (size_t i = 0; i < n; i++)
+			order[i] = static_cast<uint32_t>(i);
+		if (n == 0)
+			return;
+		const uintptr_t table = relocations.address();
+		const size_t entsize = relocations.accessor().element_size();
+		// r_offset is the first member of both Rel and Rela; ties keep the table order
+		auto target = [table, entsize](uint32_t i) {
+			return reinterpret_cast<const typename Def::Rel *>(table + i * entsize)->r_offset;
+		};
+		ELF_Def::sort(order, n, [&target](uint32_t a, uint32_t b) {
+			return target(a) < target(b) || (target(a) == target(b) && a < b);
+		});
+	}
+
+ private:
+	/*! \brief Target machine */
+	const ehdr_machine machine;
+
+	/*! \brief Analyzed segments */
+	Segment * const _segment;
+
+	/*! \brief Number of analyzed segments */
+	size_t _count;
+
+	/*! \brief Bitmap (for each segment and class) */
+	uint64_t * const _bitmap;
+
+	/*! \brief Number of pages touched by a memory range
+	 * \param virt_addr start address
+	 * \param size size of range
+	 * \param page_size size of a page
+	 * \return number of pages
+	 */
+	static size_t pages(uintptr_t virt_addr, size_t size, size_t page_size) {
+		return size == 0 ? 0 : ((virt_addr + size - 1) / page_size - virt_addr / page_size + 1);
+	}
+
+	/*! \brief Locate bit of page in bitmap
+	 * \param vaddr virtual address
+	 * \param c class of relocations
+	 * \param word index of bitmap word
+	 * \param mask mask for bit in word
+	 * \param segment optional pointer for the index of the segment
+	 * \return `false` if address is not in any loadable segment
+	 */
+	bool locate(uintptr_t vaddr, Class c, size_t & word, uint64_t & mask, size_t * segment_index = nullptr) const {
+		for (size_t i = 0; i < _count; i++) {
+			const Segment & segment = _segment[i];
+			if (vaddr >= segment.virt_addr && vaddr - segment.virt_addr < segment.virt_size) {
+				const size_t page = vaddr / page_size - segment.virt_addr / page_size;
+				word = segment.bitmap + c * ((segment.pages + bits - 1) / bits) + page / bits;
+				mask = static_cast<uint64_t>(1) << (page % bits);
+				if (segment_index != nullptr)
+					*segment_index = i;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/*! \brief Mark page (and the following one, if the word crosses the boundary) as dirtied
+	 * \param vaddr virtual address of relocation target
+	 * \param c class of relocations
+	 */
+	void mark(uintptr_t vaddr, Class c) {
+		size_t word;
+		uint64_t mask;
+		size_t segment;
+		if (locate(vaddr, c, word, mask, &segment)) {
+			_bitmap[word] |= mask;
+			_segment[segment].relocations[c]++;
+			if ((vaddr + sizeof(elfptr_t) - 1) / page_size != vaddr / page_size && locate(vaddr + sizeof(elfptr_t) - 1, c, word, mask))
+				_bitmap[word] |= mask;
+		}
+	}
+};
@@ -0,0 +1,235 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+
+/*! \brief Generated GNU hash table (`.gnu.hash`) for a symbol table
+ * Built once into caller-provided memory for symbol tables without (or with the slower ELF) hash,
+ * containing all defined symbols with a name.
+ * Since the GNU hash requires the symbols of each bucket to be consecutive,
+ * the chain is built for a permutation of the symbols (the symbol table itself is not modified):
+ * The memory contains the `.gnu.hash` image followed by the symbol index for each chain position.
+ * \note Symbols with the same name are kept in their original order, hence the first definition is found.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class GnuHashTable : private ELF_Def::Constants {
+	using SymbolTable = typename ELF<C>::SymbolTable;
+	using elfptr_t = typename ELF_Def::Structures<C>::Elf_Addr;
+
+	/*! \brief Number of bits in a bloom filter word */
+	static const uint32_t bloom_bits = sizeof(elfptr_t) * 8;
+
+	/*! \brief Position of the first hashed symbol in the chain (0 is STN_UNDEF) */
+	static const uint32_t symoffset = 1;
+
+ public:
+	/*! \brief Size of the hash table */
+	struct Parameters {
+		/*! \brief Number of hashed symbols */
+		uint32_t entries;
+		/*! \brief Number of buckets */
+		uint32_t nbuckets;
+		/*! \brief Number of bloom filter words (power of two) */
+		uint32_t bloom_size;
+		/*! \brief Shift for the second bloom filter bit */
+		uint32_t bloom_shift;
+	};
+
+	/*! \brief Underlying symbol table */
+	const SymbolTable symbols;
+
+	/*! \brief Check if a symbol is contained in the generated hash table
+	 * \param symbols symbol table
+	 * \param idx symbol index
+	 * \return `true` for defined symbols with a name
+	 */
+	static bool eligible(const SymbolTable & symbols, uint32_t idx) {
+		const char * name = symbols.name(idx);
+		return name != nullptr && name[0] != '\0' && !symbols[idx].undefined();
+	}
+
+	/*! \brief Number of symbols contained in the generated hash table
+	 * \param symbols symbol table
+	 * \return number of eligible symbols
+	 */
+	static size_t entries(const SymbolTable & symbols) {
+		size_t n = 0;
+		const auto count = symbols.count();
+		for (uint32_t i = 1; i < count; i++)
+			if (eligible(symbols, i))
+				n++;
+		return n;
+	}
+
+	/*! \brief Calculate the size of the hash table
+	 * With `b` bloom filter bits per symbol, the false positive rate of the bloom filter (two bits per symbol)
+	 * is about `(1 - e^(-2/b))^2` -- e.g. 5% for 8 and 1.4% for 16 bits.
+	 * With a load factor of `l` symbols per bucket, a successful lookup visits about `1 + l/2` chain entries
+	 * (in the hash value array, names are only compared on matching hash values),
+	 * and a share of `e^(-l)` of the buckets is empty (rejecting lookups without visiting the chain).
+	 * \param entries number of hashed symbols (see \ref entries)
+	 * \param bloom_bits_per_symbol bloom filter bits per symbol (rounded up to a power of two for the whole filter)
+	 * \param symbols_per_bucket load factor (the number of buckets is the next prime)
+	 * \return Parameters for the hash table
+	 */
+	static Parameters parameters(size_t entries, size_t bloom_bits_per_symbol = 8, size_t symbols_per_bucket = 1) {
+		assert(bloom_bits_per_symbol > 0 && symbols_per_bucket > 0);
+		Parameters p;
+		p.entries = static_cast<uint32_t>(entries);
+
+		size_t buckets = entries / symbols_per_bucket;
+		p.nbuckets = static_cast<uint32_t>(next_prime(buckets > 0 ? buckets : 1));
+
+		// Total number of bits is a power of two, the shift uses the hash bits above the word index
+		p.bloom_shift = 0;
+		while (p.bloom_shift < 31 && (static_cast<size_t>(1) << p.bloom_shift) < entries * bloom_bits_per_symbol)
+			p.bloom_shift++;
+		if ((1U << p.bloom_shift) < bloom_bits)
+			p.bloom_shift = ELF_Def::Builtin::ctz(bloom_bits);
+		p.bloom_size = (1U << p.bloom_shift) / bloom_bits;
+		return p;
+	}
+
+	/*! \brief Calculate the size of the hash table for a symbol table
+	 * \param symbols symbol table
+	 * \param bloom_bits_per_symbol bloom filter bits per symbol
+	 * \param symbols_per_bucket load factor
+	 * \return Parameters for the hash table
+	 */
+	static Parameters parameters(const SymbolTable & symbols, size_t bloom_bits_per_symbol = 8, size_t symbols_per_bucket = 1) {
+		return parameters(entries(symbols), bloom_bits_per_symbol, symbols_per_bucket);
+	}
+
+	/*! \brief Size of the `.gnu.hash` image
+	 * \param parameters size of the hash table
+	 * \return number of bytes
+	 */
+	static size_t image_size(const Parameters & parameters) {
+		return sizeof(ELF_Def::GnuHash_header) + parameters.bloom_size * sizeof(elfptr_t) + (parameters.nbuckets + parameters.entries) * sizeof(uint32_t);
+	}
+
+	/*! \brief Size of memory required to build the hash table
+	 * \param parameters size of the hash table
+	 * \return number of bytes (image and symbol index for each chain position)
+	 */
+	static size_t size(const Parameters & parameters) {
+		return image_size(parameters) + (symoffset + parameters.entries) * sizeof(uint32_t);
+	}
+
+	/*! \brief Build GNU hash table
+	 * \param symbols symbol table (e.g. from `Section::get_symbol_table()`)
+	 * \param buffer memory for the hash table (aligned for the ELF address type, must stay valid while this object is used)
+	 * \param size size of buffer in bytes (at least \ref size)
+	 * \param parameters size of the hash table (see \ref parameters)
+	 */
+	GnuHashTable(const SymbolTable & symbols, void * buffer, size_t size, const Parameters & parameters)
+	  : symbols(symbols), _header(reinterpret_cast<ELF_Def::GnuHash_header *>(buffer)) {
+		assert(buffer != nullptr && size >= GnuHashTable::size(parameters));
+		assert(reinterpret_cast<uintptr_t>(buffer) % alignof(elfptr_t) == 0);
+		assert(parameters.nbuckets > 0 && parameters.bloom_size > 0 && (parameters.bloom_size & (parameters.bloom_size - 1)) == 0);
+
+		_header->nbuckets = parameters.nbuckets;
+		_header->symoffset = symoffset;
+		_header->bloom_size = parameters.bloom_size;
+		_header->bloom_shift = parameters.bloom_shift;
+
+		elfptr_t * bloom = reinterpret_cast<elfptr_t *>(_header + 1);
+		uint32_t * buckets = reinterpret_cast<uint32_t *>(bloom + parameters.bloom_size);
+		uint32_t * chain = buckets + parameters.nbuckets;
+		uint32_t * order = chain + parameters.entries;
+		_order = order;
+
+		for (size_t i = 0; i < parameters.bloom_size; i++)
+			bloom[i] = 0;
+		for (size_t b = 0; b < parameters.nbuckets; b++)
+			buckets[b] = 0;
+		order[0] = STN_UNDEF;
+
+		// Count symbols per bucket and fill bloom filter
+		const uint32_t count = static_cast<uint32_t>(symbols.count());
+		uint32_t entries = 0;
+		for (uint32_t i = 1; i < count; i++)
+			if (eligible(symbols, i)) {
+				const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(symbols.name(i)));
+				const elfptr_t one = 1;
+				bloom[(hash_value / bloom_bits) & (parameters.bloom_size - 1)] |= (one << (hash_value % bloom_bits))
+				                                                                 | (one << ((hash_value >> parameters.bloom_shift) % bloom_bits));
+				buckets[hash_value % parameters.nbuckets]++;
+				entries++;
+			}
+		assert(entries == parameters.entries);
+
+		// Convert counts into the end of each bucket (keeping empty buckets)
+		uint32_t end = symoffset;
+		for (size_t b = 0; b < parameters.nbuckets; b++)
+			if (buckets[b] != 0)
+				buckets[b] = end += buckets[b];
+
+		// Fill from the end of each bucket in reverse symbol order, resulting in the start of each bucket
+		for (uint32_t i = count; i-- > 1;)
+			if (eligible(symbols, i)) {
+				const uint32_t hash_value = static_cast<uint32_t>(ELF_Def::gnuhash(symbols.name(i)));
+				const uint32_t n = --buckets[hash_value % parameters.nbuckets];
+				chain[n - symoffset] = hash_value & ~1U;
+				order[n] = i;
+			}
+
+		// Mark end of chains (the entry before the start of each non-empty bucket and the last entry)
+		for (size_t b = 0; b < parameters.nbuckets; b++)
+			if (buckets[b] > symoffset)
+				chain[buckets[b] - 1 - symoffset] |= 1;
+		if (entries > 0)
+			chain[entries - 1] |= 1;
+	}
+
+	/*! \brief Symbol table using the generated hash table for lookups
+	 * \return Symbol table (with section type SHT_GNU_HASH)
+	 */
+	SymbolTable table() const {
+		return SymbolTable{symbols, _header, _order};
+	}
+
+	/*! \brief The generated `.gnu.hash` image
+	 * \note The image is only valid for the symbols in chain order (see \ref order)
+	 * \return pointer to header
+	 */
+	const ELF_Def::GnuHash_header * header() const {
+		return _header;
+	}
+
+	/*! \brief Get symbol index of position in the chain
+	 * \param n position in chain (starting at symbol offset)
+	 * \return symbol index
+	 */
+	uint32_t order(uint32_t n) const {
+		return _order[n];
+	}
+
+ private:
+	/*! \brief Header of the generated image */
+	ELF_Def::GnuHash_header * const _header;
+
+	/*! \brief Symbol index for each chain position */
+	const uint32_t * _order;
+
+	/*! \brief Smallest prime not less than the value
+	 * \param value lower bound
+	 * \return prime
+	 */
+	static size_t next_prime(size_t value) {
+		for (size_t p = value < 2 ? 2 : value; true; p++) {
+			bool prime = true;
+			for (size_t d = 2; d * d <= p; d++)
+				if (p % d == 0) {
+					prime = false;
+					break;
+				}
+			if (prime)
+				return p;
+		}
+	}
+};
@@ -0,0 +1,213 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+#include "elf_scope.hpp"
+#include "elf_version.hpp"
+
+/*! \brief Lazy binding of the procedure linkage table
+ * Instead of resolving all `JUMP_SLOT` relocations at startup, the GOT entries initially point back to the PLT stubs,
+ * which push the relocation argument and jump (via PLT0) to the resolver trampoline in `GOT[2]`
+ * (together with the object identifier from `GOT[1]`).
+ * The trampoline then calls \ref resolve_plt_slot, which uses the symbol query (with the hash values)
+ * precomputed for each slot -- hence only the actually called functions are looked up.
+ * Indirect relocations (`IRELATIVE`) in the PLT relocation table cannot be bound lazily and have to be applied
+ * separately (e.g. with \ref BatchRelocator using the `INDIRECT` order).
+ * \note The trampoline itself (saving and restoring the argument registers) is not part of this library
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class LazyBinding : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using DynamicTable = typename ELF<C>::DynamicTable;
+	using Relocation = typename ELF<C>::Relocation;
+	using Relocations = typename ELF<C>::template Array<Relocation>;
+
+ public:
+	/*! \brief Symbol query (see \ref ResolutionScope) */
+	using Query = typename ResolutionScope<C>::Query;
+
+	/*! \brief Reserved entries at the begin of the global offset table */
+	enum Reserved {
+		GOT_DYNAMIC = 0,   ///< Address of the dynamic section (set by the link editor)
+		GOT_OBJECT = 1,    ///< Identifier of the object (e.g. pointer to loader data structure)
+		GOT_RESOLVER = 2,  ///< Address of the resolver trampoline
+		GOT_RESERVED = 3   ///< Number of reserved entries
+	};
+
+	/*! \brief Precomputed PLT slot */
+	struct Slot {
+		/*! \brief Symbol query (with hash values and required version) */
+		Query query;
+		/*! \brief Index of the symbol in the dynamic symbol table (or `STN_UNDEF` if the slot cannot be bound lazily) */
+		uint32_t symbol_index;
+		/*! \brief Offset of the GOT entry (relocation target) */
+		uintptr_t offset;
+
+		/*! \brief Empty slot */
+		Slot() : query(""), symbol_index(STN_UNDEF), offset(0) {}
+	};
+
+	/*! \brief Base address in target memory of the object */
+	const uintptr_t base;
+
+	/*! \brief Number of entries required for the slots
+	 * \param dynamic dynamic table
+	 * \return number of PLT relocations
+	 */
+	static size_t slots(const DynamicTable & dynamic) {
+		return dynamic.get_relocations_plt().count();
+	}
+
+	/*! \brief Precompute the PLT slots
+	 * \param elf ELF object
+	 * \param base Base address in target memory of the object
+	 * \param buffer memory for the slots (must stay valid while this object is used)
+	 * \param size number of entries in buffer (should be at least \ref slots, otherwise only the first slots are precomputed)
+	 * \param versions optional version table of the object (to look up versioned symbols)
+	 */
+	LazyBinding(const ELF<C> & elf, uintptr_t base, Slot * buffer, size_t size, const VersionTable<C> * versions = nullptr)
+	  : base(base), _slot(buffer), _count(0), _complete(true), _global_offset_table(0), _argument_scale(1) {
+		const auto dynamic = elf.dynamic();
+		dynamic.value(DT_PLTGOT, _global_offset_table);
+
+		const auto relocations = dynamic.get_relocations_plt();
+
+		// The 32-bit PLT pushes the byte offset of the relocation entry, the 64-bit one its index
+		uint32_t jump_slot;
+		switch (elf.header.machine()) {
+			case EM_386:
+			case EM_486:
+				jump_slot = R_386_JMP_SLOT;
+				_argument_scale = relocations.accessor().element_size();
+				break;
+
+			case EM_X86_64:
+				jump_slot = R_X86_64_JUMP_SLOT;
+				break;
+
+			default:  // unsupported architecture
+				assert(false);
+				jump_slot = ~0U;
+		}
+
+		const auto symbols = dynamic.get_symbol_table();
+		for (const auto & entry : relocations) {
+			if (_count >= size) {
+				_complete = false;
+				break;
+			}
+			Slot & slot = _slot[_count++];
+			slot.offset = entry.offset();
+			if (entry.type() == jump_slot && entry.symbol_index() != STN_UNDEF) {
+				slot.symbol_index = entry.symbol_index();
+				slot.query = Query(ELF_Def::SymbolKey(entry.symbol().name()));
+				const uint16_t version = symbols.version(slot.symbol_index);
+				const auto * v = versions == nullptr ? nullptr : versions->entry(version);
+				if (v != nullptr) {
+					slot.query.version = v->name;
+					slot.query.version_hash = v->hash;
+				}
+			} else {
+				slot.symbol_index = STN_UNDEF;
+			}
+		}
+	}
+
+	/*! \brief Number of precomputed PLT slots */
+	size_t count() const {
+		return _count;
+	}
+
+	/*! \brief Have all PLT slots been precomputed?
+	 * \return `false` if the buffer was too small (the remaining slots are neither prepared nor resolvable lazily)
+	 */
+	bool complete() const {
+		return _complete;
+	}
+
+	/*! \brief Get precomputed PLT slot
+	 * \param index relocation index in the PLT relocation table
+	 * \return slot
+	 */
+	const Slot & slot(size_t index) const {
+		assert(index < _count);
+		return _slot[index];
+	}
+
+	/*! \brief Pointer to the global offset table in target memory
+	 * \return pointer to first (reserved) entry or `nullptr` if the object has no `DT_PLTGOT`
+	 */
+	elfptr_t * global_offset_table() const {
+		return _global_offset_table == 0 ? nullptr : reinterpret_cast<elfptr_t *>(base + _global_offset_table);
+	}
+
+	/*! \brief Prepare the global offset table for lazy binding
+	 * Stores object identifier and trampoline in the reserved entries
+	 * and relocates the initial GOT entries of all lazy slots (pointing back to their PLT stub)
+	 * \param object identifier of the object passed to the trampoline (`GOT[1]`)
+	 * \param trampoline address of the resolver trampoline (`GOT[2]`)
+	 * \return number of lazy slots (the remaining ones, including those not precomputed, have to be relocated separately)
+	 */
+	size_t prepare(uintptr_t object, uintptr_t trampoline) const {
+		elfptr_t * got = global_offset_table();
+		assert(got != nullptr || _count == 0);
+		if (got == nullptr)
+			return 0;
+		got[GOT_OBJECT] = static_cast<elfptr_t>(object);
+		got[GOT_RESOLVER] = static_cast<elfptr_t>(trampoline);
+
+		size_t lazy = 0;
+		for (size_t i = 0; i < _count; i++)
+			if (_slot[i].symbol_index != STN_UNDEF) {
+				*reinterpret_cast<elfptr_t *>(base + _slot[i].offset) += static_cast<elfptr_t>(base);
+				lazy++;
+			}
+		return lazy;
+	}
+
+	/*! \brief Get relocation index from the argument pushed by the PLT stub
+	 * \param argument value pushed on stack (byte offset in the relocation table on 32-bit, index on 64-bit)
+	 * \return relocation index
+	 */
+	size_t index(uintptr_t argument) const {
+		return argument / _argument_scale;
+	}
+
+	/*! \brief Resolve and bind a PLT slot (in constant time, without walking the relocation table)
+	 * \param index relocation index in the PLT relocation table (see \ref index)
+	 * \param resolve resolver, called as `uintptr_t resolve(uint32_t symbol_index, const Query & query)`,
+	 *                returning the absolute address of the function (IFUNC already resolved) or `0` if not found
+	 * \return address of the function (written into the GOT entry) or `0` if it could not be resolved
+	 */
+	template<typename RESOLVER>
+	uintptr_t resolve_plt_slot(size_t index, RESOLVER resolve) const {
+		assert(index < _count);
+		const Slot & slot = _slot[index];
+		assert(slot.symbol_index != STN_UNDEF);
+		const uintptr_t value = resolve(slot.symbol_index, slot.query);
+		if (value != 0)
+			*reinterpret_cast<elfptr_t *>(base + slot.offset) = static_cast<elfptr_t>(value);
+		return value;
+	}
+
+ private:
+	/*! \brief Slots (indexed by relocation index) */
+	Slot * const _slot;
+
+	/*! \brief Number of slots */
+	size_t _count;
+
+	/*! \brief All PLT relocations have a slot */
+	bool _complete;
+
+	/*! \brief Virtual address of the global offset table (`DT_PLTGOT`) */
+	uintptr_t _global_offset_table;
+
+	/*! \brief Divisor for the argument pushed by the PLT stub */
+	size_t _argument_scale;
+};
@@ -6,9 +6,101 @@
 
 #include "elf.hpp"
 
-/*! \brief Calculate relocation */
-template<typename RELOC>
+/*! \brief Cache for the results of indirect functions (IFUNC resolvers)
+ * Each resolver (keyed by its address) is only called once while a batch of relocations is applied --
+ * the same resolvers (e.g. for `memcpy` or `strlen`) are referenced by many relocations and objects.
+ * Uses open addressing in caller-provided memory, resolvers not fitting in are called every time.
+ * \note Not thread-safe
+ */
+class IndirectCache {
+ public:
+	/*! \brief Cached result */
+	struct Entry {
+		/*! \brief Address of the resolver function (or `0` if unused) */
+		uintptr_t resolver;
+		/*! \brief Result of the resolver */
+		uintptr_t value;
+	};
+
+	/*! \brief Number of requested resolutions */
+	size_t lookups;
+
+	/*! \brief Number of resolutions answered by the cache */
+	size_t hits;
+
+	/*! \brief Constructor
+	 * \param buffer memory for the entries (must stay valid while this object is used)
+	 * \param size number of entries in buffer (should exceed the number of distinct resolvers)
+	 */
+	IndirectCache(Entry * buffer, size_t size) : _entry(buffer), _size(size) {
+		clear();
+	}
+
+	/*! \brief Forget all results and reset statistics */
+	void clear() {
+		for (size_t i = 0; i < _size; i++)
+			_entry[i].resolver = 0;
+		lookups = 0;
+		hits = 0;
+	}
+
+	/*! \brief Share of cached resolutions
+	 * \return hit rate in percent
+	 */
+	size_t hit_rate() const {
+		return lookups == 0 ? 0 : hits * 100 / lookups;
+	}
+
+	/*! \brief Get result of indirect function
+	 * \param resolver address of function resolving the symbol
+	 * \return resolved address
+	 */
+	uintptr_t resolve(uintptr_t resolver) {
+		assert(resolver != 0);
+		lookups++;
+		const size_t start = _size == 0 ? 0 : (resolver >> 4) % _size;
+		for (size_t i = 0; i < _size; i++) {
+			Entry & e = _entry[(start + i) % _size];
+			if (e.resolver == resolver) {
+				hits++;
+				return e.value;
+			} else if (e.resolver == 0) {
+				e.value = call(resolver);
+				e.resolver = resolver;
+				return e.value;
+			}
+		}
+		return call(resolver);
+	}
+
+	/*! \brief Call indirect function
+	 * \param resolver address of function resolving the symbol
+	 * \return resolved address
+	 */
+	static uintptr_t call(uintptr_t resolver) {
+		assert(resolver != 0);
+		typedef uintptr_t (*indirect_t)();
+		indirect_t func = reinterpret_cast<indirect_t>(resolver);
+		return func();
+	}
+
+ private:
+	/*! \brief Entries */
+	Entry * const _entry;
+
+	/*! \brief Number of entries */
+	const size_t _size;
+};
+
+/*! \brief Calculate relocation
+ * \tparam RELOC relocation entry type
+ * \tparam M target machine resolved at compile time (e.g. `EM_X86_64`, which has to match the ELF header),
+ *           or EM_NONE to determine it at runtime using the ELF header of the relocation entry
+ */
+template<typename RELOC, ELF_Def::Constants::ehdr_machine M = ELF_Def::Constants::EM_NONE>
 struct Relocator : private ELF_Def::Constants {
+	static_assert(M == EM_NONE || M == EM_386 || M == EM_486 || M == EM_X86_64, "Unsupported architecture");
+
 	using RELF = decltype(RELOC::_elf);
 
 	/*! \brief Offset in object to be relocated */
@@ -17,13 +109,28 @@ struct Relocator : private ELF_Def::Constants {
 	/*! \brief address of the global offset table */
 	const uintptr_t global_offset_table;
 
+	/*! \brief Cache for results of indirect functions (or `nullptr` to call them each time) */
+	IndirectCache * const indirect_cache;
+
 	/*! \brief Constructor
 	 * \param entry Relocation
 	 * \param global_offset_table address of the global offset table (in this object)
+	 * \param indirect_cache optional cache for results of indirect functions (shared by a batch of relocations)
 	 */
-	explicit Relocator(const RELOC & entry, uintptr_t global_offset_table = 0)
-	  : entry(entry), global_offset_table(global_offset_table) {
+	explicit Relocator(const RELOC & entry, uintptr_t global_offset_table = 0, IndirectCache * indirect_cache = nullptr)
+	  : entry(entry), global_offset_table(global_offset_table), indirect_cache(indirect_cache) {
 		assert(entry.valid());
+		assert(M == EM_NONE || M == entry.elf().header.machine() || (M == EM_386 && entry.elf().header.machine() == EM_486));
+	}
+
+	/*! \brief Target machine
+	 * \return compile time machine or (for EM_NONE) machine from ELF header
+	 */
+	inline ehdr_machine machine() const {
+		if constexpr (M == EM_NONE)
+			return entry.elf().header.machine();
+		else
+			return M;
 	}
 
 	/*! \brief Check if copy relocation
@@ -31,7 +138,7 @@ struct Relocator : private ELF_Def::Constants {
 	 * \param machine Elf target machine
 	 * \return `true` if copy relocation
 	 */
-	static bool is_copy(uintptr_t type, ehdr_machine machine) {
+	static constexpr bool is_copy(uintptr_t type, ehdr_machine machine) {
 		switch (machine) {
 			case EM_386:
 			case EM_486:
@@ -50,7 +157,34 @@ struct Relocator : private ELF_Def::Constants {
 	 * \return `true` if copy relocation
 	 */
 	bool is_copy() const {
-		return is_copy(entry.type(), entry.elf().header.machine());
+		return is_copy(entry.type(), machine());
+	}
+
+	/*! \brief Check if relative relocation
+	 * \param type Relocation type
+	 * \param machine Elf target machine
+	 * \return `true` if relative relocation (base address added, no symbol)
+	 */
+	static constexpr bool is_relative(uintptr_t type, ehdr_machine machine) {
+		switch (machine) {
+			case EM_386:
+			case EM_486:
+				return type == R_386_RELATIVE;
+
+			case EM_X86_64:
+				return type == R_X86_64_RELATIVE || type == R_X86_64_RELATIVE64;
+
+			default:  // unsupported architecture
+				assert(false);
+				return false;
+		}
+	}
+
+	/*! \brief Check if this is a relative relocation
+	 * \return `true` if relative relocation
+	 */
+	bool is_relative() const {
+		return is_relative(entry.type(), machine());
 	}
 
 	/*! \brief Check if indirect relocation
@@ -58,7 +192,7 @@ struct Relocator : private ELF_Def::Constants {
 	 * \param machine Elf target machine
 	 * \return `true` if indirect relocation
 	 */
-	static bool is_indirect(uintptr_t type, ehdr_machine machine) {
+	static constexpr bool is_indirect(uintptr_t type, ehdr_machine machine) {
 		switch (machine) {
 			case EM_386:
 			case EM_486:
@@ -77,7 +211,7 @@ struct Relocator : private ELF_Def::Constants {
 	 * \return `true` if indirect relocation
 	 */
 	bool is_indirect() const {
-		return is_indirect(entry.type(), entry.elf().header.machine());
+		return is_indirect(entry.type(), machine());
 	}
 
 
@@ -107,7 +241,7 @@ struct Relocator : private ELF_Def::Constants {
 		const uintptr_t S = symbol_address;
 		const uintptr_t Z = symbol.size();
 
-		switch (entry.elf().header.machine()) {
+		switch (machine()) {
 			case EM_386:
 			case EM_486:
 			switch (entry.type()) {
@@ -281,7 +415,7 @@ struct Relocator : private ELF_Def::Constants {
 	 * \return Size of relocation value
 	 */
 	inline size_t size() const {
-		return size(entry.type(), entry.elf().header.machine());
+		return size(entry.type(), machine());
 	}
 
 	/*! \brief Get size of relocation value
@@ -289,7 +423,7 @@ struct Relocator : private ELF_Def::Constants {
 	 * \param machine Elf target machine
 	 * \return Size of relocation value
 	 */
-	static size_t size(uintptr_t type, ehdr_machine machine) {
+	static constexpr size_t size(uintptr_t type, ehdr_machine machine) {
 		switch (machine) {
 			case EM_386:
 			case EM_486:
@@ -541,16 +675,12 @@ struct Relocator : private ELF_Def::Constants {
 	}
 
  private:
-	/*! \brief Call indirect function
+	/*! \brief Call indirect function (or use cached result)
 	* \param ptr address of function resolving the symbol
 	* \return resolved address
 	*/
 	inline uintptr_t ifunc(uintptr_t ptr) const {
-		assert(ptr != NULL);
-		typedef uintptr_t (*indirect_t)();
-		indirect_t func = reinterpret_cast<indirect_t>(ptr);
-		auto r = func();
-		return r;
+		return indirect_cache == nullptr ? IndirectCache::call(ptr) : indirect_cache->resolve(ptr);
 	}
 
 	/*! \brief Read from a specific memory address
@@ -592,3 +722,491 @@ struct Relocator : private ELF_Def::Constants {
 		return static_cast<uintptr_t>(*m);
 	}
 };
+
+/*! \brief Apply a whole relocation table at once
+ * The target machine (and the relocation entry format) is determined only once per table.
+ * Relocations are processed in three passes over the table, each applying only one group of types
+ * in a tight loop without further dispatch:
+ *  1. relative relocations (not depending on any symbol),
+ *  2. symbol relocations of word size (`GLOB_DAT`, `JUMP_SLOT` and the absolute address),
+ *  3. all other relocations (in their original order) using \ref Relocator -- including
+ *     copy and indirect (IFUNC) relocations, hence their sources are already relocated.
+ * Instead of the whole table, a range can be applied, optionally excluding the copy and indirect relocations
+ * (which have to be applied afterwards in order, see \ref Order).
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class BatchRelocator : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using Symbol = typename ELF<C>::Symbol;
+	using Relocation = typename ELF<C>::Relocation;
+	using Relocations = typename ELF<C>::template Array<Relocation>;
+	using DynamicTable = typename ELF<C>::DynamicTable;
+
+ public:
+	/*! \brief Definition of a symbol (provided by the resolver) */
+	struct Definition {
+		/*! \brief Absolute address of the symbol (IFUNC already resolved) or its offset in the TLS block for TLS symbols */
+		uintptr_t value;
+		/*! \brief Size of the symbol */
+		size_t size;
+		/*! \brief TLS module ID of the object defining the symbol */
+		uintptr_t tls_module_id;
+		/*! \brief TLS offset (from thread pointer) of the object defining the symbol */
+		intptr_t tls_offset;
+	};
+
+	/*! \brief Class of a symbol lookup, passed to the resolver (like `ELF_RTYPE_CLASS_*` in glibc) */
+	enum LookupClass : uint8_t {
+		LOOKUP_DEFAULT = 0,  ///< Any definition
+		LOOKUP_PLT     = 1,  ///< PLT entry (`JUMP_SLOT`), must not be resolved to a PLT stub of the executable (undefined symbol with value)
+		LOOKUP_COPY    = 2,  ///< Source of a copy relocation, hence the executable (containing the destination) has to be skipped
+		LOOKUP_CLASSES = 3   ///< Number of lookup classes
+	};
+
+	/*! \brief Memoization of resolved symbols (keyed by symbol table index and lookup class)
+	 * Several relocations usually reference the same symbol (e.g. `GLOB_DAT` and absolute relocations of a function),
+	 * with the memoization the resolver is only called for the first one.
+	 * Kept while a batch of relocation tables (of the same object) is applied.
+	 * \note Not thread-safe, hence it cannot be used with \ref ParallelRelocator
+	 */
+	class Memo {
+	 public:
+		/*! \brief Memoized definition */
+		struct Entry {
+			/*! \brief Resolved definition */
+			Definition definition;
+			/*! \brief Has the symbol already been resolved? */
+			bool resolved;
+		};
+
+		/*! \brief Number of symbol resolutions */
+		size_t lookups;
+
+		/*! \brief Number of symbol resolutions answered by the memoization */
+		size_t hits;
+
+		/*! \brief Number of entries required for the memoization
+		 * \param dynamic dynamic table
+		 * \return number of dynamic symbols times number of lookup classes
+		 */
+		static size_t entries(const DynamicTable & dynamic) {
+			return dynamic.get_symbols().count() * LOOKUP_CLASSES;
+		}
+
+		/*! \brief Constructor
+		 * \param buffer memory for the entries (must stay valid while this object is used)
+		 * \param size number of entries in buffer (should be at least \ref entries, symbols with a higher index are not memoized)
+		 */
+		Memo(Entry * buffer, size_t size) : _entry(buffer), _size(size) {
+			clear();
+		}
+
+		/*! \brief Forget all resolved symbols and reset statistics */
+		void clear() {
+			for (size_t i = 0; i < _size; i++)
+				_entry[i].resolved = false;
+			lookups = 0;
+			hits = 0;
+		}
+
+		/*! \brief Share of memoized resolutions
+		 * \return hit rate in percent
+		 */
+		size_t hit_rate() const {
+			return lookups == 0 ? 0 : hits * 100 / lookups;
+		}
+
+		/*! \brief Resolve symbol of relocation
+		 * \param index symbol table index
+		 * \param relocation relocation referencing the symbol (only accessed if not memoized)
+		 * \param lookup_class class of the lookup
+		 * \param resolve resolver
+		 * \return definition of the symbol
+		 */
+		template<typename RESOLVER>
+		Definition resolve(uint32_t index, const Relocation & relocation, LookupClass lookup_class, RESOLVER & resolve) {
+			lookups++;
+			const size_t slot = static_cast<size_t>(index) * LOOKUP_CLASSES + lookup_class;
+			if (slot < _size) {
+				Entry & e = _entry[slot];
+				if (e.resolved) {
+					hits++;
+				} else {
+					e.definition = resolve(index, relocation.symbol(), lookup_class);
+					e.resolved = true;
+				}
+				return e.definition;
+			}
+			return resolve(index, relocation.symbol(), lookup_class);
+		}
+
+	 private:
+		/*! \brief Entries (indexed by symbol table index and lookup class) */
+		Entry * const _entry;
+
+		/*! \brief Number of entries */
+		const size_t _size;
+	};
+
+	/*! \brief Selection of relocations to apply */
+	enum Order {
+		ALL,        ///< All relocations
+		UNORDERED,  ///< All except copy and indirect relocations (independent of each other, hence in any order)
+		ORDERED,    ///< Only copy and indirect relocations (depending on all other relocations)
+		RELATIVE,   ///< Only relative relocations (not depending on any symbol)
+		COPY,       ///< Only copy relocations
+		INDIRECT,   ///< Only indirect relocations (calling the IFUNC resolvers)
+	};
+
+	/*! \brief Base address in target memory of the object to which the relocations belong to */
+	const uintptr_t base;
+
+	/*! \brief Address of the global offset table (in this object) */
+	const uintptr_t global_offset_table;
+
+	/*! \brief TLS module ID of this object */
+	const uintptr_t tls_module_id;
+
+	/*! \brief TLS offset (from thread pointer) of this object */
+	const intptr_t tls_offset;
+
+	/*! \brief Cache for results of indirect functions (or `nullptr`) */
+	IndirectCache * const indirect_cache;
+
+	/*! \brief Constructor
+	 * \param elf ELF object to which the relocations belong to
+	 * \param base Base address in target memory of the object
+	 * \param global_offset_table address of the global offset table (in this object)
+	 * \param tls_module_id TLS module ID of this object
+	 * \param tls_offset TLS offset (from thread pointer / %fs) of this object
+	 * \param indirect_cache optional cache for results of indirect functions (can be shared with the relocators of other objects)
+	 */
+	explicit BatchRelocator(const ELF<C> & elf, uintptr_t base, uintptr_t global_offset_table = 0, uintptr_t tls_module_id = 0, intptr_t tls_offset = 0, IndirectCache * indirect_cache = nullptr)
+	  : base(base), global_offset_table(global_offset_table), tls_module_id(tls_module_id), tls_offset(tls_offset), indirect_cache(indirect_cache) {
+		switch (elf.header.machine()) {
+			case EM_386:
+			case EM_486:
+				relative = R_386_RELATIVE;
+				glob_dat = R_386_GLOB_DAT;
+				jump_slot = R_386_JMP_SLOT;
+				absolute = R_386_32;
+				copy = R_386_COPY;
+				irelative = R_386_IRELATIVE;
+				break;
+
+			case EM_X86_64:
+				relative = R_X86_64_RELATIVE;
+				glob_dat = R_X86_64_GLOB_DAT;
+				jump_slot = R_X86_64_JUMP_SLOT;
+				absolute = sizeof(elfptr_t) == 8 ? R_X86_64_64 : R_X86_64_32;
+				copy = R_X86_64_COPY;
+				irelative = R_X86_64_IRELATIVE;
+				break;
+
+			default:  // unsupported architecture
+				assert(false);
+				relative = glob_dat = jump_slot = absolute = copy = irelative = ~0U;
+		}
+	}
+
+	/*! \brief Apply all relocations of a table
+	 * \param relocations relocation table (e.g. from `DynamicTable::get_relocations()`)
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 *                for each relocation referencing a symbol (hence it should cache expensive lookups)
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations & relocations, RESOLVER resolve) const {
+		return apply(relocations, resolve, 0, relocations.count());
+	}
+
+	/*! \brief Apply all relocations of a table, memoizing the resolved symbols
+	 * \param relocations relocation table (e.g. from `DynamicTable::get_relocations()`)
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 *                only for symbols not yet in the memoization
+	 * \param memo memoization (to be used for all relocation tables of this object)
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations & relocations, RESOLVER resolve, Memo & memo) const {
+		return apply(relocations, resolve, 0, relocations.count(), ALL, &memo);
+	}
+
+	/*! \brief Apply a range of a relocation table
+	 * \param relocations relocation table (e.g. from `DynamicTable::get_relocations()`)
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 * \param begin index of first relocation
+	 * \param end index after last relocation
+	 * \param order selection of relocations to apply
+	 * \param memo optional memoization of resolved symbols
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations & relocations, RESOLVER resolve, size_t begin, size_t end, Order order = ALL, Memo * memo = nullptr) const {
+		assert(begin <= end && end <= relocations.count());
+		if (begin == end)
+			return 0;
+		else if (relocations.accessor().withAddend)
+			return apply(reinterpret_cast<const typename Def::Rela *>(relocations.address()), relocations, resolve, begin, end, order, memo);
+		else
+			return apply(reinterpret_cast<const typename Def::Rel *>(relocations.address()), relocations, resolve, begin, end, order, memo);
+	}
+
+	/*! \brief Apply all relocations of a table in the given order
+	 * E.g. sorted by target (see \ref DirtyPages::page_order) for better TLB and cache locality.
+	 * Copy and indirect relocations are applied afterwards in table order.
+	 * \param relocations relocation table (e.g. from `DynamicTable::get_relocations()`)
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 * \param order permutation of the relocation indices (with \ref Relocations::count elements)
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations & relocations, RESOLVER resolve, const uint32_t * order) const {
+		if (relocations.empty())
+			return 0;
+		else if (relocations.accessor().withAddend)
+			return apply(reinterpret_cast<const typename Def::Rela *>(relocations.address()), relocations, resolve, order);
+		else
+			return apply(reinterpret_cast<const typename Def::Rel *>(relocations.address()), relocations, resolve, order);
+	}
+
+	/*! \brief Apply several relocation tables, deferring the indirect relocations
+	 * First all relocations except copy and indirect ones of all tables are applied,
+	 * then the copy relocations and finally all indirect relocations in one pass
+	 * (hence the IFUNC resolvers are called successively, keeping their code hot in cache).
+	 * \param tables relocation tables (e.g. from `DynamicTable::get_relocations()` and `get_relocations_plt()`)
+	 * \param count number of relocation tables
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 * \param memo optional memoization of resolved symbols
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations * tables, size_t count, RESOLVER resolve, Memo * memo = nullptr) const {
+		static const Order passes[] = { UNORDERED, COPY, INDIRECT };
+		size_t applied = 0;
+		for (const Order order : passes)
+			for (size_t t = 0; t < count; t++)
+				applied += apply(tables[t], resolve, 0, tables[t].count(), order, memo);
+		return applied;
+	}
+
+	/*! \brief Check if relocation type has to be applied in order after all other relocations
+	 * \param type relocation type
+	 * \return `true` for copy and indirect (IFUNC) relocations
+	 */
+	bool ordered(uint32_t type) const {
+		return type == copy || type == irelative;
+	}
+
+	/*! \brief Class of the symbol lookup for a relocation type
+	 * \param type relocation type
+	 * \return lookup class passed to the resolver
+	 */
+	LookupClass lookup_class(uint32_t type) const {
+		return type == copy ? LOOKUP_COPY : (type == jump_slot ? LOOKUP_PLT : LOOKUP_DEFAULT);
+	}
+
+ private:
+	/*! \brief Relative relocation type of target machine */
+	uint32_t relative;
+
+	/*! \brief GOT entry relocation type of target machine */
+	uint32_t glob_dat;
+
+	/*! \brief PLT entry relocation type of target machine */
+	uint32_t jump_slot;
+
+	/*! \brief Absolute address (of word size) relocation type of target machine */
+	uint32_t absolute;
+
+	/*! \brief Copy relocation type of target machine */
+	uint32_t copy;
+
+	/*! \brief Indirect (IFUNC) relative relocation type of target machine */
+	uint32_t irelative;
+
+	/*! \brief Resolved symbol (interface for \ref Relocator) */
+	struct Resolved {
+		/*! \brief Definition of the symbol */
+		const Definition & definition;
+
+		/*! \brief Symbol value */
+		uintptr_t value() const {
+			return definition.value;
+		}
+
+		/*! \brief Symbol size */
+		size_t size() const {
+			return definition.size;
+		}
+
+		/*! \brief Symbol type (IFUNC is already resolved by the resolver) */
+		sym_type type() const {
+			return STT_NOTYPE;
+		}
+	};
+
+	/*! \brief Addend of relocation entry without addend */
+	static intptr_t addend(const typename Def::Rel * r) {
+		(void) r;
+		return 0;
+	}
+
+	/*! \brief Addend of relocation entry with addend */
+	static intptr_t addend(const typename Def::Rela * r) {
+		return r->r_addend;
+	}
+
+	/*! \brief Apply relative relocation without addend (implicit addend in target) */
+	void relocate_relative(const typename Def::Rel * r) const {
+		*reinterpret_cast<elfptr_t *>(base + r->r_offset) += base;
+	}
+
+	/*! \brief Apply relative relocation with addend */
+	void relocate_relative(const typename Def::Rela * r) const {
+		*reinterpret_cast<elfptr_t *>(base + r->r_offset) = base + r->r_addend;
+	}
+
+	/*! \brief Apply absolute relocation without addend (implicit addend in target) */
+	void relocate_absolute(const typename Def::Rel * r, uintptr_t value) const {
+		*reinterpret_cast<elfptr_t *>(base + r->r_offset) += value;
+	}
+
+	/*! \brief Apply absolute relocation with addend */
+	void relocate_absolute(const typename Def::Rela * r, uintptr_t value) const {
+		*reinterpret_cast<elfptr_t *>(base + r->r_offset) = value + r->r_addend;
+	}
+
+	/*! \brief Check if a relocation (not handled by the relative and word size symbol passes) is selected
+	 * \param order selection of relocations to apply
+	 * \param type relocation type
+	 * \return `true` if it has to be applied
+	 */
+	bool selected(Order order, uint32_t type) const {
+		switch (order) {
+			case ALL:       return true;
+			case UNORDERED: return !ordered(type);
+			case ORDERED:   return ordered(type);
+			case COPY:      return type == copy;
+			case INDIRECT:  return type == irelative;
+			default:        return false;
+		}
+	}
+
+	/*! \brief Resolve the symbol of a relocation
+	 * \param resolve resolver
+	 * \param memo memoization of resolved symbols (or `nullptr`)
+	 * \param index symbol table index
+	 * \param relocation relocation referencing the symbol
+	 * \param lookup_class class of the lookup
+	 * \return definition of the symbol
+	 */
+	template<typename RESOLVER>
+	static Definition lookup(RESOLVER & resolve, Memo * memo, uint32_t index, const Relocation & relocation, LookupClass lookup_class) {
+		return memo == nullptr ? resolve(index, relocation.symbol(), lookup_class) : memo->resolve(index, relocation, lookup_class, resolve);
+	}
+
+	/*! \brief Apply a range of relocations of a table
+	 * \tparam R relocation entry structure
+	 * \param table first relocation entry
+	 * \param relocations relocation table
+	 * \param resolve symbol resolver
+	 * \param begin index of first relocation
+	 * \param end index after last relocation
+	 * \param order selection of relocations to apply
+	 * \param memo memoization of resolved symbols (or `nullptr`)
+	 * \return number of applied relocations
+	 */
+	template<typename R, typename RESOLVER>
+	size_t apply(const R * table, const Relocations & relocations, RESOLVER & resolve, size_t begin, size_t end, Order order, Memo * memo) const {
+		size_t applied = 0;
+
+		if (order == ALL || order == UNORDERED || order == RELATIVE) {
+			// Relative relocations
+			for (size_t i = begin; i < end; i++)
+				if (table[i].r_info.type == relative) {
+					relocate_relative(table + i);
+					applied++;
+				}
+
+			// Symbol relocations of word size
+			for (size_t i = begin; i < end && order != RELATIVE; i++) {
+				const uint32_t type = table[i].r_info.type;
+				if (type == glob_dat || type == jump_slot) {
+					const Definition definition = lookup(resolve, memo, static_cast<uint32_t>(table[i].r_info.sym), relocations[i], type == jump_slot ? LOOKUP_PLT : LOOKUP_DEFAULT);
+					assert(addend(table + i) == 0);
+					*reinterpret_cast<elfptr_t *>(base + table[i].r_offset) = definition.value;
+					applied++;
+				} else if (type == absolute && table[i].r_info.sym != STN_UNDEF) {
+					const Definition definition = lookup(resolve, memo, static_cast<uint32_t>(table[i].r_info.sym), relocations[i], LOOKUP_DEFAULT);
+					relocate_absolute(table + i, definition.value);
+					applied++;
+				}
+			}
+		}
+
+		// Other relocations
+		for (size_t i = begin; i < end && order != RELATIVE; i++) {
+			const uint32_t type = table[i].r_info.type;
+			if (type != relative && type != glob_dat && type != jump_slot && (type != absolute || table[i].r_info.sym == STN_UNDEF)
+			    && selected(order, type)) {
+				relocate(relocations[i], static_cast<uint32_t>(table[i].r_info.sym), resolve, memo);
+				applied++;
+			}
+		}
+
+		return applied;
+	}
+
+	/*! \brief Apply relocations of a table in the given order
+	 * \tparam R relocation entry structure
+	 * \param table first relocation entry
+	 * \param relocations relocation table
+	 * \param resolve symbol resolver
+	 * \param order permutation of the relocation indices
+	 * \return number of applied relocations
+	 */
+	template<typename R, typename RESOLVER>
+	size_t apply(const R * table, const Relocations & relocations, RESOLVER & resolve, const uint32_t * order) const {
+		const size_t n = relocations.count();
+		size_t applied = 0;
+		for (size_t o = 0; o < n; o++) {
+			const uint32_t i = order[o];
+			assert(i < n);
+			const uint32_t type = table[i].r_info.type;
+			const uint32_t symbol_index = static_cast<uint32_t>(table[i].r_info.sym);
+			if (type == relative) {
+				relocate_relative(table + i);
+			} else if (type == glob_dat || type == jump_slot) {
+				assert(addend(table + i) == 0);
+				*reinterpret_cast<elfptr_t *>(base + table[i].r_offset) = lookup(resolve, nullptr, symbol_index, relocations[i], type == jump_slot ? LOOKUP_PLT : LOOKUP_DEFAULT).value;
+			} else if (type == absolute && symbol_index != STN_UNDEF) {
+				relocate_absolute(table + i, lookup(resolve, nullptr, symbol_index, relocations[i], LOOKUP_DEFAULT).value);
+			} else if (!ordered(type)) {
+				relocate(relocations[i], symbol_index, resolve, nullptr);
+			} else {
+				continue;
+			}
+			applied++;
+		}
+		return applied + apply(table, relocations, resolve, 0, n, ORDERED, nullptr);
+	}
+
+	/*! \brief Apply relocation using \ref Relocator
+	 * \param entry relocation entry
+	 * \param symbol_index index of referenced symbol
+	 * \param resolve symbol resolver
+	 * \param memo memoization of resolved symbols (or `nullptr`)
+	 */
+	template<typename RESOLVER>
+	void relocate(const Relocation & entry, uint32_t symbol_index, RESOLVER & resolve, Memo * memo) const {
+		// Without symbol, the object itself is referenced (like \ref Relocator::value_internal)
+		const bool internal = symbol_index == STN_UNDEF;
+		const Definition definition = internal ? Definition{ 0, 0, tls_module_id, tls_offset } : lookup(resolve, memo, symbol_index, entry, lookup_class(entry.type()));
+		const Resolved symbol{ definition };
+		const Relocator<Relocation> relocator(entry, global_offset_table, indirect_cache);
+		relocator.fix_value_external(base, symbol, relocator.value_external(base, symbol, internal ? base : 0, 0, definition.tls_module_id, definition.tls_offset));
+	}
+};
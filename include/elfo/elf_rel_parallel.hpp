@@ -0,0 +1,302 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf_rel.hpp"
+
+#ifndef USE_DLH
+#include <pthread.h>
+#endif
+
+/*! \brief Apply a relocation table using multiple threads
+ * The table is split into partitions of consecutive entries, whose targets are in disjoint pages
+ * (hence no two threads write the same page or cache line).
+ * Since each target page is relocated by exactly one thread (in table order), the result is deterministic.
+ * Linkers usually sort the relocations by their target (at least the relative ones),
+ * partitions with overlapping targets (e.g. the relative relocations for `.init_array` and
+ * the symbol relocations for the global offset table) are grouped and processed by the same worker.
+ * Copy and indirect (IFUNC) relocations are excluded from the partitions and applied sequentially
+ * (in table order) after all partitions have been processed.
+ * Partitions are assigned to a pool of worker threads (pthreads), or processed sequentially with DLH.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class ParallelRelocator : public BatchRelocator<C> {
+	using Base = BatchRelocator<C>;
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using Relocations = typename ELF<C>::template Array<typename ELF<C>::Relocation>;
+	using RelocationRelativeList = typename ELF<C>::RelocationRelativeList;
+
+ public:
+	/*! \brief Maximum number of worker threads */
+	static const size_t max_workers = 64;
+
+	/*! \brief Range of relocation entries
+	 * Partitions of the same group are processed (in order) by a single worker,
+	 * their targets are in pages not touched by any other group.
+	 */
+	struct Partition {
+		/*! \brief Index of first entry */
+		size_t begin;
+		/*! \brief Index after last entry */
+		size_t end;
+		/*! \brief First target page (page number, i.e. target offset divided by page size), for the whole group in its first partition */
+		uintptr_t first_page;
+		/*! \brief Last target page (or less than first page if there are no targets), for the whole group in its first partition */
+		uintptr_t last_page;
+		/*! \brief Index of the first partition of the group */
+		size_t group;
+		/*! \brief Offset represented by a leading bitmap entry (only for relative relocation lists) */
+		uintptr_t offset;
+	};
+
+	/*! \brief Size of a page (granularity of the partitions) */
+	const size_t page_size;
+
+	/*! \brief Constructor
+	 * \param elf ELF object to which the relocations belong to
+	 * \param base Base address in target memory of the object
+	 * \param global_offset_table address of the global offset table (in this object)
+	 * \param tls_module_id TLS module ID of this object
+	 * \param tls_offset TLS offset (from thread pointer / %fs) of this object
+	 * \param page_size size of a page (at least the size of a cache line)
+	 */
+	explicit ParallelRelocator(const ELF<C> & elf, uintptr_t base, uintptr_t global_offset_table = 0, uintptr_t tls_module_id = 0, intptr_t tls_offset = 0, size_t page_size = 4096)
+	  : Base(elf, base, global_offset_table, tls_module_id, tls_offset), page_size(page_size) {
+		assert(page_size > 0);
+	}
+
+	/*! \brief Split a relocation table into partitions
+	 * \param relocations relocation table (e.g. from `DynamicTable::get_relocations()`)
+	 * \param partitions array for the partitions
+	 * \param max number of elements in partitions array (upper bound for the number of partitions)
+	 * \param min_entries minimum number of entries in a partition (to amortize the costs of a worker)
+	 * \return number of partitions
+	 */
+	size_t partition(const Relocations & relocations, Partition * partitions, size_t max, size_t min_entries = 1024) const {
+		if (relocations.empty() || max == 0)
+			return 0;
+		else if (relocations.accessor().withAddend)
+			return partition(reinterpret_cast<const typename Def::Rela *>(relocations.address()), relocations.count(), partitions, max, min_entries);
+		else
+			return partition(reinterpret_cast<const typename Def::Rel *>(relocations.address()), relocations.count(), partitions, max, min_entries);
+	}
+
+	/*! \brief Split a list of relative relocations (`DT_RELR`) into partitions
+	 * Partitions might start with a bitmap entry, the offset it continues from is stored in the partition.
+	 * \param relocations relative relocation list (e.g. from `DynamicTable::get_relative_relocations()`)
+	 * \param partitions array for the partitions
+	 * \param max number of elements in partitions array (upper bound for the number of partitions)
+	 * \param min_entries minimum number of entries in a partition (each bitmap entry represents up to 63 or 31 relocations)
+	 * \return number of partitions
+	 */
+	size_t partition(const RelocationRelativeList & relocations, Partition * partitions, size_t max, size_t min_entries = 64) const {
+		const typename Def::Relr * table = relocations.accessor().ptr();
+		const size_t n = relocations.count();
+		if (n == 0 || max == 0)
+			return 0;
+		const size_t chunk = chunk_size(n, max, min_entries);
+		const size_t bits = 8 * sizeof(elfptr_t) - 1;
+		size_t count = 0;
+		uintptr_t where = 0;
+		for (size_t begin = 0; begin < n;) {
+			Partition p = { begin, begin, ~static_cast<uintptr_t>(0), 0, 0, where };
+			for (; p.end < n; p.end++) {
+				// First and last target of the entry
+				const elfptr_t value = table[p.end].r_value;
+				const bool targets = (value & 1) == 0 || (value >> 1) != 0;
+				uintptr_t first = value;
+				uintptr_t last = value;
+				if ((value & 1) != 0 && targets) {
+					// The marker bit 0 represents no word
+					first = where + ELF_Def::Builtin::ctz(static_cast<elfptr_t>(value >> 1)) * sizeof(elfptr_t);
+					last = where + (bits - 1 - ELF_Def::Builtin::clz(value)) * sizeof(elfptr_t);
+				}
+
+				// Continue with ascending entries up to the chunk size and entries in the last target page
+				// (the last possible partition takes all remaining entries)
+				if (p.end > begin && count + 1 < max && targets) {
+					const uintptr_t page = first / page_size;
+					if (page < p.last_page || (p.end >= begin + chunk && page != p.last_page))
+						break;
+				}
+
+				where = (value & 1) == 0 ? value + sizeof(elfptr_t) : where + bits * sizeof(elfptr_t);
+				if (targets) {
+					if (first / page_size < p.first_page)
+						p.first_page = first / page_size;
+					if ((last + sizeof(elfptr_t) - 1) / page_size > p.last_page)
+						p.last_page = (last + sizeof(elfptr_t) - 1) / page_size;
+				}
+			}
+			append(partitions, count, p);
+			begin = p.end;
+		}
+		return count;
+	}
+
+	/*! \brief Apply partitioned relocation table
+	 * \param relocations relocation table
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 *                concurrently by the worker threads (hence it has to be thread-safe)
+	 * \param partitions partitions of the relocation table (see \ref partition)
+	 * \param count number of partitions
+	 * \param workers number of threads (including the calling thread)
+	 * \return number of applied relocations
+	 */
+	template<typename RESOLVER>
+	size_t apply(const Relocations & relocations, RESOLVER resolve, const Partition * partitions, size_t count, size_t workers) const {
+		auto work = [&](const Partition & p) -> size_t {
+			return Base::apply(relocations, resolve, p.begin, p.end, Base::UNORDERED);
+		};
+		const size_t applied = run(partitions, count, workers, work);
+		return applied + Base::apply(relocations, resolve, 0, relocations.count(), Base::ORDERED);
+	}
+
+	/*! \brief Apply partitioned list of relative relocations (`DT_RELR`)
+	 * \param relocations relative relocation list
+	 * \param partitions partitions of the relocation list (see \ref partition)
+	 * \param count number of partitions
+	 * \param workers number of threads (including the calling thread)
+	 * \return number of applied relocations
+	 */
+	size_t apply_relative(const RelocationRelativeList & relocations, const Partition * partitions, size_t count, size_t workers) const {
+		typename Def::Relr * table = const_cast<typename Def::Relr *>(relocations.accessor().ptr());
+		auto work = [&](const Partition & p) -> size_t {
+			return RelocationRelativeList{ relocations.accessor(), table + p.begin, p.end - p.begin }.apply_relative(this->base, p.offset);
+		};
+		return run(partitions, count, workers, work);
+	}
+
+ private:
+	/*! \brief Number of entries per partition
+	 * Only half of the partitions are used for sorted tables, the others are reserved for
+	 * the additional partitions required by descending targets (e.g. the global offset table at the end).
+	 * \param n number of entries
+	 * \param max maximum number of partitions
+	 * \param min_entries minimum number of entries in a partition
+	 * \return entries per partition (at least one)
+	 */
+	static size_t chunk_size(size_t n, size_t max, size_t min_entries) {
+		const size_t half = (max + 1) / 2;
+		const size_t chunk = (n + half - 1) / half;
+		return chunk < min_entries ? min_entries : (chunk > 0 ? chunk : 1);
+	}
+
+	/*! \brief Split a relocation table into partitions
+	 * \tparam R relocation entry structure
+	 * \param table first relocation entry
+	 * \param n number of relocation entries
+	 * \param partitions array for the partitions
+	 * \param max number of elements in partitions array
+	 * \param min_entries minimum number of entries in a partition
+	 * \return number of partitions
+	 */
+	template<typename R>
+	size_t partition(const R * table, size_t n, Partition * partitions, size_t max, size_t min_entries) const {
+		const size_t chunk = chunk_size(n, max, min_entries);
+		size_t count = 0;
+		for (size_t begin = 0; begin < n;) {
+			Partition p = { begin, begin, ~static_cast<uintptr_t>(0), 0, 0, 0 };
+			// Continue with ascending entries up to the chunk size and entries in the last target page
+			// (the last possible partition takes all remaining entries)
+			while (p.end < n && (p.end == begin || count + 1 >= max
+			                     || (table[p.end].r_offset / page_size >= table[p.end - 1].r_offset / page_size
+			                         && (p.end < begin + chunk || table[p.end].r_offset / page_size == table[p.end - 1].r_offset / page_size)))) {
+				const R & r = table[p.end++];
+				if (!this->ordered(static_cast<uint32_t>(r.r_info.type))) {
+					if (r.r_offset / page_size < p.first_page)
+						p.first_page = r.r_offset / page_size;
+					if ((r.r_offset + sizeof(elfptr_t) - 1) / page_size > p.last_page)
+						p.last_page = (r.r_offset + sizeof(elfptr_t) - 1) / page_size;
+				}
+			}
+			append(partitions, count, p);
+			begin = p.end;
+		}
+		return count;
+	}
+
+	/*! \brief Append partition, grouping it with all partitions having overlapping targets
+	 * \param partitions array of partitions
+	 * \param count number of partitions in array
+	 * \param p partition to append
+	 */
+	static void append(Partition * partitions, size_t & count, const Partition & p) {
+		const size_t index = count++;
+		partitions[index] = p;
+		partitions[index].group = index;
+		// Merge overlapping groups into the one with the lower index (a merged group might overlap further ones)
+		for (size_t i = 0; i < count;) {
+			Partition & g = partitions[partitions[index].group];
+			Partition & o = partitions[i];
+			if (o.group == i && &o != &g && o.first_page <= g.last_page && g.first_page <= o.last_page) {
+				Partition & to = i < g.group ? o : g;
+				const size_t from = i < g.group ? g.group : i;
+				if (partitions[from].first_page < to.first_page)
+					to.first_page = partitions[from].first_page;
+				if (partitions[from].last_page > to.last_page)
+					to.last_page = partitions[from].last_page;
+				for (size_t j = from; j < count; j++)
+					if (partitions[j].group == from)
+						partitions[j].group = to.group;
+				i = 0;
+			} else {
+				i++;
+			}
+		}
+	}
+
+	/*! \brief Process partitions on a pool of workers
+	 * Each worker (including the calling thread) takes the next unprocessed group of partitions until all are done.
+	 * \param partitions array of partitions
+	 * \param count number of partitions
+	 * \param workers number of threads
+	 * \param work function processing a partition, returning the number of applied relocations
+	 * \return number of applied relocations
+	 */
+	template<typename WORK>
+	static size_t run(const Partition * partitions, size_t count, size_t workers, WORK & work) {
+		struct Pool {
+			const Partition * partitions;
+			size_t count;
+			WORK & work;
+			size_t next;
+			size_t applied;
+
+			static void * worker(void * arg) {
+				Pool * pool = reinterpret_cast<Pool *>(arg);
+				size_t applied = 0;
+				for (size_t i; (i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count; )
+					if (pool->partitions[i].group == i)
+						for (size_t j = i; j < pool->count; j++)
+							if (pool->partitions[j].group == i)
+								applied += pool->work(pool->partitions[j]);
+				__atomic_fetch_add(&pool->applied, applied, __ATOMIC_RELAXED);
+				return nullptr;
+			}
+		} pool = { partitions, count, work, 0, 0 };
+
+#ifndef USE_DLH
+		if (workers > count)
+			workers = count;
+		if (workers > max_workers)
+			workers = max_workers;
+		pthread_t threads[max_workers];
+		size_t started = 0;
+		// If a thread cannot be created, the remaining partitions are processed by the others
+		while (started + 1 < workers && pthread_create(threads + started, nullptr, Pool::worker, &pool) == 0)
+			started++;
+		Pool::worker(&pool);
+		for (size_t t = 0; t < started; t++)
+			pthread_join(threads[t], nullptr);
+#else
+		(void) workers;
+		Pool::worker(&pool);
+#endif
+		return pool.applied;
+	}
+};
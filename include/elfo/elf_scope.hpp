@@ -0,0 +1,238 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+#include "elf_version.hpp"
+
+/*! \brief Symbol resolution in an ordered scope of multiple objects
+ * Following the rules of the GNU dynamic linker (ld.so):
+ * The objects are searched in their order and the first definition wins,
+ * ignoring undefined and local symbols as well as symbols with unsuitable types.
+ * Weak definitions are final as well, unless `dynamic_weak` (`LD_DYNAMIC_WEAK`) is set:
+ * Then a subsequent global definition is preferred.
+ * \note The version of a symbol is checked according to \ref ELF::SymbolTable::index --
+ *       without a requested version, hidden versions are ignored and the default version is used (like `dlsym`)
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class ResolutionScope : private ELF_Def::Constants {
+	using Symbol = typename ELF<C>::Symbol;
+	using SymbolTable = typename ELF<C>::SymbolTable;
+	using DynamicTable = typename ELF<C>::DynamicTable;
+
+	/*! \brief Version index for versions not defined in an object (only matching unversioned symbols) */
+	static const uint16_t VER_NDX_UNDEFINED = VER_NDX_LORESERVE;
+
+ public:
+	/*! \brief Object in scope */
+	struct Object {
+		/*! \brief Dynamic symbol table (e.g. to set up a negative cache) */
+		SymbolTable symbols;
+
+		/*! \brief Versions of the object */
+		const VersionTable<C> versions;
+
+		/*! \brief The object has version definitions */
+		const bool versioned;
+
+		/*! \brief Number of version table entries required for an object
+		 * \param dynamic dynamic table of ELF object
+		 */
+		static size_t entries(const DynamicTable & dynamic) {
+			return VersionTable<C>::entries(dynamic);
+		}
+
+		/*! \brief Object using its dynamic section
+		 * \param elf ELF object (must stay valid while this object is used)
+		 * \param buffer memory for the version table (must stay valid while this object is used)
+		 * \param size number of entries in buffer (should be at least \ref entries)
+		 */
+		Object(const ELF<C> & elf, typename VersionTable<C>::Entry * buffer, size_t size) : Object(elf.dynamic(), buffer, size) {}
+
+		/*! \brief Object using its dynamic section
+		 * \param dynamic dynamic table of ELF object
+		 * \param buffer memory for the version table (must stay valid while this object is used)
+		 * \param size number of entries in buffer (should be at least \ref entries)
+		 */
+		Object(const DynamicTable & dynamic, typename VersionTable<C>::Entry * buffer, size_t size)
+		  : symbols(dynamic.get_symbol_table()), versions(dynamic, buffer, size), versioned(!dynamic.get_version_definition().empty()) {}
+
+		/*! \brief Get version index of version definition
+		 * \param name version name (or `nullptr` if no version is required)
+		 * \param hash ELF hash value of version name
+		 * \return Version index, SymbolTable::default_version if no version is required or VER_NDX_GLOBAL if the object has no version definitions
+		 */
+		uint16_t version_index(const char * name, uint32_t hash) const {
+			if (name == nullptr)
+				return SymbolTable::default_version;
+			else if (!versioned)
+				return VER_NDX_GLOBAL;
+			const uint16_t index = versions.definition(name, hash);
+			return index == VER_NDX_GLOBAL ? VER_NDX_UNDEFINED : index;
+		}
+	};
+
+	/*! \brief Symbol query */
+	struct Query {
+		/*! \brief Symbol name with hash values */
+		ELF_Def::SymbolKey key;
+
+		/*! \brief Required version name (or `nullptr`) */
+		const char * version;
+
+		/*! \brief ELF hash value of version name */
+		uint32_t version_hash;
+
+		/*! \brief Create query (all hash values are calculated once)
+		 * \param name symbol name
+		 * \param version required version name (or `nullptr`)
+		 */
+		constexpr Query(const char * name, const char * version = nullptr)  // NOLINT
+		  : key(name), version(version), version_hash(ELF_Def::hash(version)) {}
+
+		/*! \brief Create query
+		 * \param key symbol key with precomputed hash values
+		 * \param version required version name (or `nullptr`)
+		 */
+		constexpr Query(const ELF_Def::SymbolKey & key, const char * version = nullptr)  // NOLINT
+		  : key(key), version(version), version_hash(ELF_Def::hash(version)) {}
+	};
+
+	/*! \brief Result of symbol resolution */
+	struct Result {
+		/*! \brief Index of the object (in scope) containing the definition */
+		uint32_t object;
+
+		/*! \brief Symbol index in the objects dynamic symbol table (or STN_UNDEF if not found) */
+		uint32_t index;
+
+		/*! \brief Definition has weak binding */
+		bool weak;
+
+		/*! \brief Has a definition been found? */
+		bool found() const {
+			return index != STN_UNDEF;
+		}
+	};
+
+	/*! \brief Objects in scope (in search order) */
+	const Object * const objects;
+
+	/*! \brief Number of objects in scope */
+	const size_t count;
+
+	/*! \brief Prefer subsequent global definitions over a weak one (like `LD_DYNAMIC_WEAK`) */
+	const bool dynamic_weak;
+
+	/*! \brief Create scope
+	 * \param objects array of objects (in search order, must stay valid while this scope is used)
+	 * \param count number of objects
+	 * \param dynamic_weak prefer subsequent global definitions over a weak one
+	 */
+	ResolutionScope(const Object * objects, size_t count, bool dynamic_weak = false)
+	  : objects(objects), count(count), dynamic_weak(dynamic_weak) {}
+
+	/*! \brief Resolve symbol
+	 * \param query symbol query
+	 * \param first index of the first object to search (e.g. `1` to skip the executable for the source of a copy relocation)
+	 * \return result of resolution
+	 */
+	Result resolve(const Query & query, size_t first = 0) const {
+		Result result = { 0, STN_UNDEF, false };
+		for (size_t o = first; o < count; o++)
+			if (update(result, o, query))
+				break;
+		return result;
+	}
+
+	/*! \brief Resolve multiple symbols at once
+	 * The objects are searched in the outer loop, hence the (bloom filter of the) hash table
+	 * of an object remains in cache while all unresolved queries are looked up.
+	 * \param queries array of symbol queries
+	 * \param n number of queries
+	 * \param results array (with at least `n` elements) for the result of each query
+	 * \return number of resolved queries
+	 */
+	size_t resolve_many(const Query * queries, size_t n, Result * results) const {
+		for (size_t i = 0; i < n; i++)
+			results[i] = { 0, STN_UNDEF, false };
+
+		size_t pending = n;
+		size_t resolved = 0;
+		for (size_t o = 0; o < count && pending > 0; o++)
+			for (size_t i = 0; i < n; i++)
+				if (!is_final(results[i]) && update(results[i], o, queries[i]) && --pending == 0)
+					break;
+
+		for (size_t i = 0; i < n; i++)
+			if (results[i].found())
+				resolved++;
+		return resolved;
+	}
+
+	/*! \brief Get resolved symbol
+	 * \param result result of resolution
+	 * \return Symbol (STN_UNDEF if not found)
+	 */
+	Symbol symbol(const Result & result) const {
+		assert(result.object < count);
+		return objects[result.object].symbols[result.index];
+	}
+
+ private:
+	/*! \brief Check if the result will not change by searching further objects */
+	bool is_final(const Result & result) const {
+		return result.found() && !(dynamic_weak && result.weak);
+	}
+
+	/*! \brief Search definition in object and update result
+	 * \param result current result of resolution
+	 * \param o index of object in scope
+	 * \param query symbol query
+	 * \return `true` if the result is final
+	 */
+	bool update(Result & result, size_t o, const Query & query) const {
+		const uint32_t idx = lookup(objects[o], query);
+		if (idx != STN_UNDEF) {
+			const bool weak = objects[o].symbols[idx].bind() == STB_WEAK;
+			if (!result.found() || (result.weak && !weak))
+				result = { static_cast<uint32_t>(o), idx, weak };
+		}
+		return is_final(result);
+	}
+
+	/*! \brief Find definition of a symbol in an object
+	 * \param object object to search
+	 * \param query symbol query
+	 * \return symbol index or STN_UNDEF if not defined
+	 */
+	static uint32_t lookup(const Object & object, const Query & query) {
+		// Reject using bloom filter only
+		if (!object.symbols.may_contain(query.key.gnuhash))
+			return STN_UNDEF;
+
+		const uint32_t idx = static_cast<uint32_t>(object.symbols.index(query.key, object.version_index(query.version, query.version_hash)));
+		if (idx == STN_UNDEF)
+			return STN_UNDEF;
+
+		const auto sym = object.symbols[idx];
+		if (sym.undefined() || sym.bind() == STB_LOCAL)
+			return STN_UNDEF;
+
+		switch (sym.type()) {
+			case STT_TLS:
+				return idx;
+			case STT_NOTYPE:
+			case STT_OBJECT:
+			case STT_FUNC:
+			case STT_COMMON:
+			case STT_GNU_IFUNC:
+				return sym.value() != 0 ? idx : STN_UNDEF;
+			default:
+				return STN_UNDEF;
+		}
+	}
+};
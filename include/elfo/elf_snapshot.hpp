@@ -0,0 +1,355 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf_rel.hpp"
+#include "elf_def/sort.hpp"
+
+/*! \brief Snapshot of relocated values for replay on the next load (like prelink)
+ * After an object has been relocated, the final value of each slot of the non-relative relocations is recorded,
+ * relative to the base address of the dependency defining the referenced symbol (as reported by the resolver)
+ * or as absolute value (e.g. for TLS offsets).
+ * As long as the same dependencies are loaded (identified by the fingerprint of their build IDs),
+ * replaying the snapshot (and applying the relative relocations as usual) replaces symbol resolution entirely,
+ * even if the objects are loaded at different base addresses.
+ *
+ * The snapshot is a compact position independent image in caller-provided memory
+ * (a \ref Header followed by the \ref Entry array, sorted by offset),
+ * hence it can be directly written to and mapped from a file.
+ * \note Indirect (IFUNC) relocations store the result of the resolver function, which might depend on the CPU.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class RelocationSnapshot : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using Relocation = typename ELF<C>::Relocation;
+	using Relocations = typename ELF<C>::template Array<Relocation>;
+
+ public:
+	/*! \brief Format version */
+	static const uint32_t version = 1;
+
+	/*! \brief Dependency index for absolute values */
+	static const uint16_t absolute = 0xffff;
+
+	/*! \brief Snapshot file header */
+	struct Header {
+		/*! \brief Identification (`ELFOSNAP`) */
+		char magic[8];
+		/*! \brief Format version */
+		uint32_t version;
+		/*! \brief Size of an address (4 or 8 bytes) */
+		uint16_t address_size;
+		/*! \brief Target machine */
+		uint16_t machine;
+		/*! \brief Fingerprint of the dependency set (see \ref fingerprint) */
+		uint64_t fingerprint;
+		/*! \brief Number of entries */
+		uint64_t entries;
+	} __attribute__((packed));
+
+	/*! \brief Kind of snapshot entry */
+	enum Kind : uint16_t {
+		VALUE = 0,  ///< Write value (relative to dependency base) to slot
+		COPY  = 1,  ///< Copy memory (at offset in dependency) to slot
+	};
+
+	/*! \brief Snapshot entry */
+	struct Entry {
+		/*! \brief Offset of the slot in the object */
+		uint64_t offset;
+		/*! \brief Value or source offset (relative to the base of the dependency) */
+		uint64_t value;
+		/*! \brief Size of the slot (or number of bytes to copy) */
+		uint32_t size;
+		/*! \brief Index of the dependency (or \ref absolute) */
+		uint16_t dependency;
+		/*! \brief Kind of entry */
+		Kind kind;
+	} __attribute__((packed));
+
+	/*! \brief Memory range of a loaded object in the dependency set */
+	struct Dependency {
+		/*! \brief Base address */
+		uintptr_t base;
+		/*! \brief Size of the memory image */
+		size_t size;
+	};
+
+	/*! \brief Definition of a symbol (provided by the resolver) */
+	struct Definition {
+		/*! \brief Absolute address of the symbol (only required for the source of copy relocations) */
+		uintptr_t value;
+		/*! \brief Index of the dependency defining the symbol (or \ref absolute for TLS and unresolved weak symbols) */
+		uint16_t dependency;
+	};
+
+	/*! \brief Constructor
+	 * \param elf ELF object to which the relocations belong to
+	 */
+	explicit RelocationSnapshot(const ELF<C> & elf) : machine(elf.header.machine()) {
+		switch (machine) {
+			case EM_386:
+			case EM_486:
+				relative = R_386_RELATIVE;
+				break;
+
+			case EM_X86_64:
+				relative = R_X86_64_RELATIVE;
+				break;
+
+			default:  // unsupported architecture
+				assert(false);
+				relative = ~0U;
+		}
+	}
+
+	/*! \brief Fingerprint of a dependency set
+	 * Combines the build IDs (`NT_GNU_BUILD_ID`) of all objects in their order,
+	 * objects without build ID are identified by the contents of their loadable segments (slow).
+	 * \param objects ELF objects in the dependency set (first one is the object itself)
+	 * \param n number of objects
+	 * \return 64-bit FNV-1a hash value
+	 */
+	static uint64_t fingerprint(const ELF<C> * objects, size_t n) {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < n; i++) {
+			size_t size = 0;
+			const void * id = build_id(objects[i], size);
+			if (id != nullptr) {
+				hash = fnv1a(hash, id, size);
+			} else {
+				for (const auto & s : objects[i].segments)
+					if (s.type() == PT_LOAD)
+						hash = fnv1a(hash, s.data(), s.size());
+			}
+			// Separator
+			hash = fnv1a(hash, &i, sizeof(i));
+		}
+		return hash;
+	}
+
+	/*! \brief Required size of the snapshot
+	 * \param tables relocation tables of the object (e.g. from `DynamicTable::get_relocations()` and `get_relocations_plt()`)
+	 * \param n number of relocation tables
+	 * \return number of bytes
+	 */
+	size_t size(const Relocations * tables, size_t n) const {
+		size_t entries = 0;
+		for (size_t t = 0; t < n; t++)
+			for (const auto & entry : tables[t])
+				if (entry.type() != relative)
+					entries++;
+		return sizeof(Header) + entries * sizeof(Entry);
+	}
+
+	/*! \brief Record the relocated values of an object
+	 * \param tables relocation tables of the object
+	 * \param n number of relocation tables
+	 * \param resolve resolver, called as `Definition resolve(uint32_t symbol_index, const Symbol & symbol, LookupClass lookup_class)`
+	 *                for each relocation referencing a symbol, reporting the dependency which defined it during relocation
+	 * \param dependencies memory ranges of the dependency set (the first one is the relocated object itself)
+	 * \param dependency_count number of dependencies
+	 * \param fingerprint fingerprint of the dependency set
+	 * \param buffer memory for the snapshot
+	 * \param size size of buffer (should be at least \ref size)
+	 * \return size of the snapshot in bytes, or `0` if the buffer is too small
+	 *         or the object contains relocations which cannot be replayed (e.g. PC relative)
+	 */
+	template<typename RESOLVER>
+	size_t record(const Relocations * tables, size_t n, RESOLVER resolve, const Dependency * dependencies, size_t dependency_count, uint64_t fingerprint, void * buffer, size_t size) const {
+		assert(dependency_count > 0 && dependency_count < absolute);
+		if (size < sizeof(Header))
+			return 0;
+		const size_t capacity = (size - sizeof(Header)) / sizeof(Entry);
+		const uintptr_t base = dependencies[0].base;
+
+		Header * header = reinterpret_cast<Header *>(buffer);
+		Entry * entries = reinterpret_cast<Entry *>(header + 1);
+		size_t count = 0;
+		for (size_t t = 0; t < n; t++)
+			for (const auto & entry : tables[t]) {
+				const uint32_t type = entry.type();
+				if (type == relative)
+					continue;
+				else if (!replayable(type) || count >= capacity)
+					return 0;
+
+				const Relocator<Relocation> relocator(entry);
+				const uint32_t symbol_index = entry.symbol_index();
+				Entry & e = entries[count++];
+				e.offset = entry.offset();
+
+				// Without symbol, the object itself is referenced (except for TLS offsets and module IDs)
+				Definition definition = { 0, tls(type) ? absolute : static_cast<uint16_t>(0) };
+				if (symbol_index != STN_UNDEF)
+					definition = resolve(symbol_index, entry.symbol(), relocator.is_copy() ? BatchRelocator<C>::LOOKUP_COPY : BatchRelocator<C>::LOOKUP_DEFAULT);
+				assert(definition.dependency == absolute || definition.dependency < dependency_count);
+
+				uintptr_t value;
+				if (relocator.is_copy()) {
+					assert(definition.dependency != absolute);
+					value = definition.value;
+					e.size = static_cast<uint32_t>(entry.symbol().size());
+					e.kind = COPY;
+				} else {
+					value = relocator.read_value(base);
+					e.size = static_cast<uint32_t>(relocator.size());
+					e.kind = VALUE;
+				}
+
+				// Relative to the defining dependency (word size only, smaller values are always absolute)
+				if (definition.dependency != absolute && (e.kind == COPY || e.size == sizeof(elfptr_t))) {
+					e.dependency = definition.dependency;
+					e.value = value - dependencies[definition.dependency].base;
+				} else {
+					e.dependency = absolute;
+					e.value = value;
+				}
+			}
+
+		// Sorted by offset (for sequential writes during replay)
+		ELF_Def::sort(entries, count, [](const Entry & a, const Entry & b) { return a.offset < b.offset; });
+
+		const char magic[8] = { 'E', 'L', 'F', 'O', 'S', 'N', 'A', 'P' };
+		for (size_t i = 0; i < sizeof(magic); i++)
+			header->magic[i] = magic[i];
+		header->version = version;
+		header->address_size = sizeof(elfptr_t);
+		header->machine = static_cast<uint16_t>(machine);
+		header->fingerprint = fingerprint;
+		header->entries = count;
+		return sizeof(Header) + count * sizeof(Entry);
+	}
+
+	/*! \brief Check if a snapshot can be replayed
+	 * \param snapshot snapshot memory (e.g. mapped file)
+	 * \param size size of snapshot
+	 * \param fingerprint fingerprint of the current dependency set
+	 * \return `true` if the snapshot is valid for this object and dependency set
+	 */
+	bool valid(const void * snapshot, size_t size, uint64_t fingerprint) const {
+		const Header * header = reinterpret_cast<const Header *>(snapshot);
+		return snapshot != nullptr && size >= sizeof(Header)
+		    && header->magic[0] == 'E' && header->magic[1] == 'L' && header->magic[2] == 'F' && header->magic[3] == 'O'
+		    && header->magic[4] == 'S' && header->magic[5] == 'N' && header->magic[6] == 'A' && header->magic[7] == 'P'
+		    && header->version == version && header->address_size == sizeof(elfptr_t) && header->machine == machine
+		    && header->fingerprint == fingerprint && (size - sizeof(Header)) / sizeof(Entry) >= header->entries;
+	}
+
+	/*! \brief Replay a snapshot
+	 * \note Relative relocations are not part of the snapshot, they have to be applied separately
+	 *       (e.g. using \ref BatchRelocator with \ref BatchRelocator::RELATIVE or `RelocationRelativeList::apply_relative`)
+	 * \param snapshot valid snapshot (see \ref valid)
+	 * \param dependencies memory ranges of the current dependency set (the first one is the object itself)
+	 * \param dependency_count number of dependencies
+	 * \return number of replayed relocations
+	 */
+	size_t replay(const void * snapshot, const Dependency * dependencies, size_t dependency_count) const {
+		const Header * header = reinterpret_cast<const Header *>(snapshot);
+		const Entry * entries = reinterpret_cast<const Entry *>(header + 1);
+		const uintptr_t base = dependencies[0].base;
+		for (size_t i = 0; i < header->entries; i++) {
+			const Entry & e = entries[i];
+			assert(e.dependency == absolute || e.dependency < dependency_count);
+			const uintptr_t value = (e.dependency == absolute ? 0 : dependencies[e.dependency].base) + static_cast<uintptr_t>(e.value);
+			void * slot = reinterpret_cast<void *>(base + e.offset);
+			if (e.kind == COPY) {
+				memcpy(slot, reinterpret_cast<const void *>(value), e.size);
+			} else {
+				switch (e.size) {
+					case 1: *reinterpret_cast<uint8_t *>(slot) = static_cast<uint8_t>(value); break;
+					case 2: *reinterpret_cast<uint16_t *>(slot) = static_cast<uint16_t>(value); break;
+					case 4: *reinterpret_cast<uint32_t *>(slot) = static_cast<uint32_t>(value); break;
+					case 8: *reinterpret_cast<uint64_t *>(slot) = static_cast<uint64_t>(value); break;
+				}
+			}
+		}
+		(void) dependency_count;
+		return header->entries;
+	}
+
+ private:
+	/*! \brief Target machine */
+	const ehdr_machine machine;
+
+	/*! \brief Relative relocation type of target machine */
+	uint32_t relative;
+
+	/*! \brief Check if the value of a relocation type can be replayed
+	 * \param type relocation type
+	 * \return `false` for PC relative relocations (depending on the distance between the objects)
+	 */
+	bool replayable(uint32_t type) const {
+		switch (machine) {
+			case EM_386:
+			case EM_486:
+				return type != R_386_PC32 && type != R_386_PC16 && type != R_386_PC8 && type != R_386_PLT32;
+
+			case EM_X86_64:
+				return type != R_X86_64_PC32 && type != R_X86_64_PC16 && type != R_X86_64_PC8 && type != R_X86_64_PC64 && type != R_X86_64_PLT32;
+
+			default:
+				return false;
+		}
+	}
+
+	/*! \brief Check if a relocation type refers to thread local storage
+	 * \param type relocation type
+	 * \return `true` for TLS module IDs and offsets (which are not addresses)
+	 */
+	bool tls(uint32_t type) const {
+		switch (machine) {
+			case EM_386:
+			case EM_486:
+				return type == R_386_TLS_DTPMOD32 || type == R_386_TLS_DTPOFF32 || type == R_386_TLS_TPOFF || type == R_386_TLS_TPOFF32 || type == R_386_TLS_DESC;
+
+			case EM_X86_64:
+				return type == R_X86_64_DTPMOD64 || type == R_X86_64_DTPOFF64 || type == R_X86_64_DTPOFF32 || type == R_X86_64_TPOFF64 || type == R_X86_64_TPOFF32 || type == R_X86_64_TLSDESC;
+
+			default:
+				return false;
+		}
+	}
+
+	/*! \brief Get build ID of an object
+	 * \param elf ELF object
+	 * \param size size of the build ID
+	 * \return pointer to build ID or `nullptr` if not available
+	 */
+	static const void * build_id(const ELF<C> & elf, size_t & size) {
+		for (const auto & s : elf.segments)
+			if (s.type() == PT_NOTE) {
+				const size_t align = s.alignment() > 4 ? s.alignment() : 4;
+				const uintptr_t start = reinterpret_cast<uintptr_t>(s.data());
+				for (uintptr_t p = start; p + sizeof(typename Def::Nhdr) <= start + s.size();) {
+					const auto * note = reinterpret_cast<const typename Def::Nhdr *>(p);
+					const uintptr_t desc = p + sizeof(typename Def::Nhdr) + ((note->n_namesz + align - 1) & ~(align - 1));
+					if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && strcmp(reinterpret_cast<const char *>(note + 1), "GNU") == 0) {
+						size = note->n_descsz;
+						return reinterpret_cast<const void *>(desc);
+					}
+					p = desc + ((note->n_descsz + align - 1) & ~(align - 1));
+				}
+			}
+		return nullptr;
+	}
+
+	/*! \brief Update FNV-1a hash
+	 * \param hash current hash value
+	 * \param data memory
+	 * \param size number of bytes
+	 * \return new hash value
+	 */
+	static uint64_t fnv1a(uint64_t hash, const void * data, size_t size) {
+		const uint8_t * bytes = reinterpret_cast<const uint8_t *>(data);
+		for (size_t i = 0; i < size; i++) {
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ULL;
+		}
+		return hash;
+	}
+};
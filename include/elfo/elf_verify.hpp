@@ -0,0 +1,898 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+
+template<ELFCLASS C>
+class Validator;
+
+/*! \brief Checked accessors for unverified input
+ * Each access is bounds-checked against the file size and the referenced section,
+ * returning `nullptr` (or `false`) instead of reading outside the file.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class Checked : private ELF_Def::Constants {
+	friend class Validator<C>;
+
+ protected:
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+
+	/*! \brief ELF object */
+	const ELF<C> & _elf;
+
+	/*! \brief Start address of the file in memory */
+	const uintptr_t _base;
+
+	/*! \brief Size of the file */
+	const size_t _size;
+
+ public:
+	/*! \brief Checked access to an ELF file
+	 * \param elf ELF object
+	 * \param file_size length of the memory mapped file
+	 */
+	Checked(const ELF<C> & elf, size_t file_size)
+	  : _elf(elf), _base(reinterpret_cast<uintptr_t>(&elf.header)), _size(file_size) {}
+
+	/*! \brief ELF object */
+	const ELF<C> & elf() const {
+		return _elf;
+	}
+
+	/*! \brief Is a range within the file?
+	 * \param offset file offset
+	 * \param size length of the range
+	 * \return `true` if the range is completely inside
+	 */
+	bool inside(uintptr_t offset, size_t size) const {
+		return offset <= _size && size <= _size - offset;
+	}
+
+	/*! \brief Is a file offset suitably aligned for a structure?
+	 * \tparam T structure
+	 * \param offset file offset
+	 * \return `true` if aligned
+	 */
+	template<typename T>
+	bool aligned(uintptr_t offset) const {
+		return (_base + offset) % alignof(T) == 0;
+	}
+
+	/*! \brief Section header
+	 * \param index section index
+	 * \return pointer to section header or `nullptr` if index or header are out of bounds
+	 */
+	const typename Def::Shdr * section(uint16_t index) const {
+		const auto & header = _elf.header;
+		if (index >= header.e_shnum || header.e_shentsize != sizeof(typename Def::Shdr) || !aligned<typename Def::Shdr>(header.e_shoff)
+		 || !inside(header.e_shoff + index * sizeof(typename Def::Shdr), sizeof(typename Def::Shdr)))
+			return nullptr;
+		return reinterpret_cast<const typename Def::Shdr *>(_base + header.e_shoff) + index;
+	}
+
+	/*! \brief Link to another section
+	 * \param index section index
+	 * \param link reference to store the linked section index
+	 * \return `false` if section or link are invalid
+	 */
+	bool link(uint16_t index, uint16_t & link) const {
+		const auto * shdr = section(index);
+		if (shdr == nullptr || shdr->sh_link >= _elf.header.e_shnum)
+			return false;
+		link = static_cast<uint16_t>(shdr->sh_link);
+		return true;
+	}
+
+	/*! \brief Get string
+	 * \param section string table section index
+	 * \param offset offset of string in table
+	 * \return String or `nullptr` if not a (terminated) string in the table
+	 */
+	const char * string(uint16_t section, uint32_t offset) const {
+		const auto * shdr = this->section(section);
+		if (shdr == nullptr || shdr->sh_type != SHT_STRTAB || offset >= shdr->sh_size || !inside(shdr->sh_offset, shdr->sh_size))
+			return nullptr;
+		const char * table = reinterpret_cast<const char *>(_base + shdr->sh_offset);
+		for (size_t i = offset; i < shdr->sh_size; i++)
+			if (table[i] == '\0')
+				return table + offset;
+		return nullptr;
+	}
+
+	/*! \brief Section name
+	 * \param index section index
+	 * \return Name or `nullptr` if invalid
+	 */
+	const char * section_name(uint16_t index) const {
+		const auto * shdr = section(index);
+		return shdr == nullptr ? nullptr : string(_elf.header.e_shstrndx, shdr->sh_name);
+	}
+
+	/*! \brief Symbol name
+	 * \note Like \ref ELF::Symbol::name, the section name is used for unnamed section symbols
+	 * \param section symbol table section index
+	 * \param index index of symbol in table
+	 * \return Name or `nullptr` if invalid
+	 */
+	const char * symbol_name(uint16_t section, uint32_t index) const {
+		const typename Def::Sym * sym = symbol(section, index);
+		uint16_t strtab;
+		if (sym == nullptr || !link(section, strtab))
+			return nullptr;
+		const char * name = string(strtab, sym->st_name);
+		if (name != nullptr && name[0] == '\0' && sym->st_info.type == STT_SECTION)
+			return section_name(sym->st_shndx);
+		return name;
+	}
+
+	/*! \brief Number of symbols covered by a GNU hash table
+	 * \param section GNU hash section index
+	 * \param entries reference to store the number of symbols
+	 * \return `false` if the hash table is invalid
+	 */
+	bool gnu_hash_size(uint16_t section, size_t & entries) const {
+		const auto * shdr = this->section(section);
+		return shdr != nullptr && shdr->sh_type == SHT_GNU_HASH && gnu_hash_size(shdr->sh_offset, shdr->sh_size, entries);
+	}
+
+ protected:
+	/*! \brief Symbol
+	 * \param section symbol table section index
+	 * \param index index of symbol in table
+	 * \return pointer to symbol or `nullptr` if invalid
+	 */
+	const typename Def::Sym * symbol(uint16_t section, uint32_t index) const {
+		const auto * shdr = this->section(section);
+		if (shdr == nullptr || (shdr->sh_type != SHT_SYMTAB && shdr->sh_type != SHT_DYNSYM)
+		 || shdr->sh_entsize != sizeof(typename Def::Sym) || index >= shdr->sh_size / sizeof(typename Def::Sym)
+		 || !inside(shdr->sh_offset, shdr->sh_size) || !aligned<typename Def::Sym>(shdr->sh_offset))
+			return nullptr;
+		return reinterpret_cast<const typename Def::Sym *>(_base + shdr->sh_offset) + index;
+	}
+
+	/*! \brief Number of symbols covered by a GNU hash table
+	 * \param offset file offset of the hash table
+	 * \param size size limit of the hash table
+	 * \param entries reference to store the number of symbols
+	 * \return `false` if the hash table is invalid
+	 */
+	bool gnu_hash_size(uintptr_t offset, size_t size, size_t & entries) const {
+		if (!inside(offset, size) || size < sizeof(ELF_Def::GnuHash_header) || !aligned<elfptr_t>(offset))
+			return false;
+		const auto * header = reinterpret_cast<const ELF_Def::GnuHash_header *>(_base + offset);
+		// Both bloom filter size and number of buckets are used as divisors in the lookup
+		if (header->nbuckets == 0 || header->bloom_size == 0 || header->bloom_shift >= 8 * sizeof(elfptr_t))
+			return false;
+		const size_t words = (size - sizeof(ELF_Def::GnuHash_header)) / sizeof(uint32_t);
+		const size_t bloom = header->bloom_size * (sizeof(elfptr_t) / sizeof(uint32_t));
+		if (bloom > words || header->nbuckets > words - bloom)
+			return false;
+		const uint32_t * buckets = reinterpret_cast<const uint32_t *>(header + 1) + bloom;
+		const size_t chain_words = words - bloom - header->nbuckets;
+
+		size_t n = 0;
+		for (uint32_t i = 0; i < header->nbuckets; i++)
+			if (buckets[i] != 0) {
+				if (buckets[i] < header->symoffset)
+					return false;
+				if (buckets[i] > n)
+					n = buckets[i];
+			}
+		if (n == 0) {
+			entries = header->symoffset;
+			return true;
+		}
+
+		// The last chain has to be terminated within the table
+		const uint32_t * chain = buckets + header->nbuckets;
+		for (size_t i = n - header->symoffset; i < chain_words; i++)
+			if ((chain[i] & 1) != 0) {
+				entries = header->symoffset + i + 1;
+				return true;
+			}
+		return false;
+	}
+};
+
+/*! \brief Token of a successfully validated ELF file
+ * Can only be created by \ref Validator.
+ * Offers the same accessors as \ref Checked, but without any checks (since the file is known to be consistent).
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class Verified : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+
+	friend class Validator<C>;
+
+	/*! \brief ELF object */
+	const ELF<C> * _elf;
+
+	/*! \brief Start address of the file in memory */
+	uintptr_t _base;
+
+	/*! \brief Size of the file */
+	size_t _size;
+
+	/*! \brief Create token (only by validator) */
+	Verified(const ELF<C> & elf, size_t file_size)
+	  : _elf(&elf), _base(reinterpret_cast<uintptr_t>(&elf.header)), _size(file_size) {}
+
+	/*! \brief Section header */
+	const typename Def::Shdr & shdr(uint16_t index) const {
+		return reinterpret_cast<const typename Def::Shdr *>(_base + _elf->header.e_shoff)[index];
+	}
+
+ public:
+	/*! \brief Verified ELF object */
+	const ELF<C> & elf() const {
+		return *_elf;
+	}
+
+	/*! \brief Size of the verified file */
+	size_t size() const {
+		return _size;
+	}
+
+	/*! \brief Link to another section
+	 * \param index section index
+	 * \param link reference to store the linked section index
+	 * \return always `true`
+	 */
+	bool link(uint16_t index, uint16_t & link) const {
+		link = static_cast<uint16_t>(shdr(index).sh_link);
+		return true;
+	}
+
+	/*! \brief Get string
+	 * \param section string table section index
+	 * \param offset offset of string in table
+	 * \return String
+	 */
+	const char * string(uint16_t section, uint32_t offset) const {
+		return reinterpret_cast<const char *>(_base + shdr(section).sh_offset + offset);
+	}
+
+	/*! \brief Section name
+	 * \param index section index
+	 * \return Name or `nullptr` if the file has no section name string table
+	 */
+	const char * section_name(uint16_t index) const {
+		const uint16_t shstrndx = _elf->header.e_shstrndx;
+		return shstrndx == SHN_UNDEF ? nullptr : string(shstrndx, shdr(index).sh_name);
+	}
+
+	/*! \brief Symbol name
+	 * \param section symbol table section index
+	 * \param index index of symbol in table
+	 * \return Name (`nullptr` for unnamed section symbols if the file has no section name string table)
+	 */
+	const char * symbol_name(uint16_t section, uint32_t index) const {
+		const typename Def::Shdr & symtab = shdr(section);
+		const typename Def::Sym & sym = reinterpret_cast<const typename Def::Sym *>(_base + symtab.sh_offset)[index];
+		const char * name = string(static_cast<uint16_t>(symtab.sh_link), sym.st_name);
+		return name[0] == '\0' && sym.st_info.type == STT_SECTION ? section_name(sym.st_shndx) : name;
+	}
+
+	/*! \brief Number of symbols covered by a GNU hash table
+	 * \param section GNU hash section index
+	 * \param entries reference to store the number of symbols
+	 * \return always `true`
+	 */
+	bool gnu_hash_size(uint16_t section, size_t & entries) const {
+		const auto * header = reinterpret_cast<const ELF_Def::GnuHash_header *>(_base + shdr(section).sh_offset);
+		const uint32_t * buckets = reinterpret_cast<const uint32_t *>(reinterpret_cast<const elfptr_t *>(header + 1) + header->bloom_size);
+		size_t n = 0;
+		for (uint32_t i = 0; i < header->nbuckets; i++)
+			if (buckets[i] > n)
+				n = buckets[i];
+		if (n == 0) {
+			entries = header->symoffset;
+		} else {
+			for (const uint32_t * chain = buckets + header->nbuckets - header->symoffset; (chain[n] & 1) == 0; n++) {}
+			entries = n + 1;
+		}
+		return true;
+	}
+};
+
+/*! \brief Thorough one-pass validation of an ELF file
+ * In addition to \ref ELF::valid, all string offsets (section, symbol, dynamic and version names),
+ * symbol, hash (including chain termination), version and note tables,
+ * and relocation tables (symbol indices and targets) are bounds-checked -- both via section header table
+ * and via dynamic segment.
+ * On success, a \ref Verified token is provided, allowing accessors to skip all further checks,
+ * while the \ref Checked accessors remain available for unverified input.
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class Validator : private ELF_Def::Constants {
+	using Def = ELF_Def::Structures<C>;
+	using elfptr_t = typename Def::Elf_Addr;
+	using LoadMap = typename ELF<C>::LoadMap;
+
+ public:
+	/*! \brief Validation result */
+	enum Error {
+		NONE,                 ///< Valid file
+		UNCHECKED,            ///< Not validated yet
+		BOUNDS,               ///< Headers, segments or sections exceed the file (see \ref ELF::valid)
+		SECTION_NAMES,        ///< Invalid section header string table or section name
+		SECTION_LINK,         ///< Link to invalid section or section of wrong type
+		STRING_TABLE,         ///< String table not terminated
+		SYMBOL_TABLE,         ///< Invalid symbol table or symbol name
+		HASH_TABLE,           ///< Invalid (or cyclic) ELF hash table
+		GNU_HASH_TABLE,       ///< Invalid GNU hash table
+		RELOCATION,           ///< Invalid relocation table, symbol index or target
+		RELATIVE_RELOCATION,  ///< Invalid relative relocation table or target
+		VERSION,              ///< Invalid version table
+		NOTE,                 ///< Invalid note
+		DYNAMIC               ///< Invalid dynamic table (including referenced tables and strings)
+	};
+
+	/*! \brief Prepare validation of an ELF file
+	 * \param elf ELF object
+	 * \param file_size length of the memory mapped file
+	 */
+	Validator(const ELF<C> & elf, size_t file_size)
+	  : _checked(elf, file_size), _error(UNCHECKED), _section(SHN_UNDEF), _loads(), _token(elf, file_size) {}
+
+	/*! \brief Validate the file (only the first call performs the checks)
+	 * \return result
+	 */
+	Error validate() {
+		if (_error == UNCHECKED) {
+			_error = BOUNDS;
+			const auto & header = _checked._elf.header;
+			if (_checked._elf.valid(_checked._size)
+			 && header.e_ehsize == sizeof(header)
+			 && (header.e_phentsize == sizeof(typename Def::Phdr) || header.e_phnum == 0)
+			 && _checked.template aligned<typename Def::Phdr>(header.e_phoff)
+			 && (header.e_shentsize == sizeof(typename Def::Shdr) || header.e_shnum == 0)) {
+				_loads = LoadMap{_checked._elf};
+				_error = check_sections();
+				if (_error == NONE) {
+					_section = SHN_UNDEF;
+					_error = check_dynamic();
+				}
+			}
+		}
+		return _error;
+	}
+
+	/*! \brief Checked accessors (e.g. for reporting the cause of an error) */
+	const Checked<C> & checked() const {
+		return _checked;
+	}
+
+	/*! \brief Validation result */
+	Error error() const {
+		return _error;
+	}
+
+	/*! \brief Index of the section causing the error (`SHN_UNDEF` if not caused by a section) */
+	uint16_t section() const {
+		return _section;
+	}
+
+	/*! \brief Token for accessors skipping all checks
+	 * \return pointer to token or `nullptr` if the file is not (yet) validated successfully
+	 */
+	const Verified<C> * verified() const {
+		return _error == NONE ? &_token : nullptr;
+	}
+
+ private:
+	/*! \brief Checked access to the file */
+	const Checked<C> _checked;
+
+	/*! \brief Validation result */
+	Error _error;
+
+	/*! \brief Index of the section causing the error */
+	uint16_t _section;
+
+	/*! \brief Address translation index */
+	LoadMap _loads;
+
+	/*! \brief Token (only handed out on success) */
+	const Verified<C> _token;
+
+	/*! \brief Pointer to file contents */
+	template<typename T>
+	const T * at(uintptr_t offset) const {
+		return reinterpret_cast<const T *>(_checked._base + offset);
+	}
+
+	/*! \brief Is a virtual memory range (e.g. a relocation target) part of loadable segments? */
+	bool loaded(uintptr_t vaddr, size_t size) const {
+		uintptr_t offset;
+		return vaddr + size >= vaddr
+		    && _loads.locate(vaddr, offset) != LoadMap::NOT_LOADED
+		    && _loads.locate(vaddr + size - 1, offset) != LoadMap::NOT_LOADED;
+	}
+
+	/*! \brief Translate a virtual memory range to a file range
+	 * \param vaddr virtual address
+	 * \param size length of the range
+	 * \param offset reference to store the file offset
+	 * \return `false` if the range is not backed by the file
+	 */
+	bool in_file(uintptr_t vaddr, size_t size, uintptr_t & offset) const {
+		return _loads.locate(vaddr, offset) == LoadMap::IN_FILE && _checked.inside(offset, size);
+	}
+
+	/*! \brief Does a section link to a section of the expected type? */
+	bool links_to(const typename Def::Shdr & shdr, typename Def::shdr_type type) const {
+		const auto * link = _checked.section(static_cast<uint16_t>(shdr.sh_link));
+		return shdr.sh_link != SHN_UNDEF && link != nullptr && link->sh_type == type;
+	}
+
+	/*! \brief Check all sections */
+	Error check_sections() {
+		const size_t n = _checked._elf.header.e_shnum;
+		const uint16_t shstrndx = _checked._elf.header.e_shstrndx;
+		if (n > 0 && shstrndx != SHN_UNDEF) {
+			const auto * shstrtab = _checked.section(shstrndx);
+			if (shstrtab == nullptr || shstrtab->sh_type != SHT_STRTAB)
+				return SECTION_NAMES;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			_section = static_cast<uint16_t>(i);
+			const typename Def::Shdr & shdr = *_checked.section(_section);
+			if (shdr.sh_link >= n)
+				return SECTION_LINK;
+			if (shstrndx != SHN_UNDEF && _checked.section_name(_section) == nullptr)
+				return SECTION_NAMES;
+
+			Error e = NONE;
+			switch (shdr.sh_type) {
+				case SHT_STRTAB:
+					if (shdr.sh_size > 0 && *at<char>(shdr.sh_offset + shdr.sh_size - 1) != '\0')
+						e = STRING_TABLE;
+					break;
+
+				case SHT_SYMTAB:
+				case SHT_DYNSYM:
+					e = check_symbols(shdr);
+					break;
+
+				case SHT_HASH:
+					e = links_to(shdr, SHT_DYNSYM) || links_to(shdr, SHT_SYMTAB)
+					  ? check_hash(shdr.sh_offset, shdr.sh_size, _checked.section(static_cast<uint16_t>(shdr.sh_link))->sh_size / sizeof(typename Def::Sym))
+					  : SECTION_LINK;
+					break;
+
+				case SHT_GNU_HASH:
+				{
+					size_t entries = 0;
+					if (!links_to(shdr, SHT_DYNSYM) && !links_to(shdr, SHT_SYMTAB))
+						e = SECTION_LINK;
+					else if (!_checked.gnu_hash_size(shdr.sh_offset, shdr.sh_size, entries)
+					      || entries > _checked.section(static_cast<uint16_t>(shdr.sh_link))->sh_size / sizeof(typename Def::Sym))
+						e = GNU_HASH_TABLE;
+					break;
+				}
+
+				case SHT_REL:
+				case SHT_RELA:
+				{
+					const bool rela = shdr.sh_type == SHT_RELA;
+					size_t symbols = 0;
+					if (shdr.sh_link != SHN_UNDEF) {
+						if (!links_to(shdr, SHT_DYNSYM) && !links_to(shdr, SHT_SYMTAB)) {
+							e = SECTION_LINK;
+							break;
+						}
+						symbols = _checked.section(static_cast<uint16_t>(shdr.sh_link))->sh_size / sizeof(typename Def::Sym);
+					}
+					// Relocatable objects (and relocations of non-allocated sections) address the section referenced by info,
+					// all others the virtual memory
+					const typename Def::Shdr * target = nullptr;
+					if (_checked._elf.header.type() == Def::ET_REL || shdr.sh_info != SHN_UNDEF) {
+						target = _checked.section(static_cast<uint16_t>(shdr.sh_info));
+						if (target == nullptr) {
+							e = SECTION_LINK;
+							break;
+						} else if (_checked._elf.header.type() != Def::ET_REL && target->sh_flags.alloc == 1) {
+							target = nullptr;
+						}
+					}
+					if (shdr.sh_entsize != (rela ? sizeof(typename Def::Rela) : sizeof(typename Def::Rel)))
+						e = RELOCATION;
+					else
+						e = check_relocations(shdr.sh_offset, shdr.sh_size, shdr.sh_entsize, symbols, target);
+					break;
+				}
+
+				case SHT_RELR:
+					e = shdr.sh_entsize == sizeof(typename Def::Relr) ? check_relr(shdr.sh_offset, shdr.sh_size) : RELATIVE_RELOCATION;
+					break;
+
+				case SHT_DYNAMIC:
+					if (shdr.sh_entsize != sizeof(typename Def::Dyn) || !links_to(shdr, SHT_STRTAB))
+						e = DYNAMIC;
+					break;
+
+				case SHT_GNU_VERSYM:
+					if (shdr.sh_entsize != sizeof(uint16_t) || !links_to(shdr, SHT_DYNSYM)
+					 || shdr.sh_size / sizeof(uint16_t) != _checked.section(static_cast<uint16_t>(shdr.sh_link))->sh_size / sizeof(typename Def::Sym))
+						e = VERSION;
+					break;
+
+				case SHT_GNU_VERDEF:
+				case SHT_GNU_VERNEED:
+					e = links_to(shdr, SHT_STRTAB)
+					  ? check_versions(shdr.sh_offset, shdr.sh_size, _checked.section(static_cast<uint16_t>(shdr.sh_link))->sh_size, shdr.sh_type == SHT_GNU_VERDEF)
+					  : SECTION_LINK;
+					break;
+
+				case SHT_NOTE:
+					e = check_notes(shdr.sh_offset, shdr.sh_size);
+					break;
+
+				default:
+					break;
+			}
+			if (e != NONE)
+				return e;
+		}
+		_section = SHN_UNDEF;
+		return NONE;
+	}
+
+	/*! \brief Check symbol table (including the symbol names) */
+	Error check_symbols(const typename Def::Shdr & shdr) const {
+		if (shdr.sh_entsize != sizeof(typename Def::Sym) || shdr.sh_size % sizeof(typename Def::Sym) != 0 || !_checked.template aligned<typename Def::Sym>(shdr.sh_offset))
+			return SYMBOL_TABLE;
+		if (!links_to(shdr, SHT_STRTAB))
+			return SECTION_LINK;
+		const auto * strtab = _checked.section(static_cast<uint16_t>(shdr.sh_link));
+		const auto * sym = at<typename Def::Sym>(shdr.sh_offset);
+		const size_t shnum = _checked._elf.header.e_shnum;
+		for (size_t i = 0; i < shdr.sh_size / sizeof(typename Def::Sym); i++)
+			if (sym[i].st_name >= strtab->sh_size)
+				return SYMBOL_TABLE;
+			else if (sym[i].st_shndx >= shnum && sym[i].st_shndx < SHN_LORESERVE)
+				return SYMBOL_TABLE;
+			// Unnamed section symbols are named after their section, which therefore has to be a real one
+			else if (sym[i].st_info.type == STT_SECTION && *at<char>(strtab->sh_offset + sym[i].st_name) == '\0'
+			      && (sym[i].st_shndx == SHN_UNDEF || sym[i].st_shndx >= shnum))
+				return SYMBOL_TABLE;
+		return NONE;
+	}
+
+	/*! \brief Check ELF hash table
+	 * \param offset file offset of the table
+	 * \param size size (limit) of the table
+	 * \param symbols number of symbols in the associated symbol table (or `0` if unknown)
+	 */
+	Error check_hash(uintptr_t offset, size_t size, size_t symbols) const {
+		if (!_checked.inside(offset, size) || size < 2 * sizeof(uint32_t) || !_checked.template aligned<uint32_t>(offset))
+			return HASH_TABLE;
+		const uint32_t * table = at<uint32_t>(offset);
+		const size_t nbucket = table[0];
+		const size_t nchain = table[1];
+		if (nbucket == 0 || (symbols != 0 && nchain != symbols) || nbucket + nchain > size / sizeof(uint32_t) - 2)
+			return HASH_TABLE;
+		const uint32_t * bucket = table + 2;
+		const uint32_t * chain = bucket + nbucket;
+		// Each symbol belongs to exactly one chain, hence all chains together have at most nchain elements
+		size_t steps = 0;
+		for (size_t b = 0; b < nbucket; b++)
+			for (uint32_t i = bucket[b]; i != STN_UNDEF; i = chain[i])
+				if (i >= nchain || ++steps > nchain)
+					return HASH_TABLE;
+		return NONE;
+	}
+
+	/*! \brief Check relocation table
+	 * \param offset file offset of the table
+	 * \param size size of the table
+	 * \param entsize size of an entry
+	 * \param symbols number of symbols in the associated symbol table (`0` if there is none)
+	 * \param target section of the relocation targets (relative to the section) or `nullptr` for virtual memory
+	 */
+	Error check_relocations(uintptr_t offset, size_t size, size_t entsize, size_t symbols, const typename Def::Shdr * target) const {
+		if (!_checked.inside(offset, size) || entsize < sizeof(typename Def::Rel) || size % entsize != 0 || !_checked.template aligned<typename Def::Rela>(offset))
+			return RELOCATION;
+		for (size_t i = 0; i < size / entsize; i++) {
+			const auto * rel = at<typename Def::Rel>(offset + i * entsize);
+			if (rel->r_info.sym != STN_UNDEF && rel->r_info.sym >= symbols)
+				return RELOCATION;
+			// Targets in sections are only checked for their start (since the size depends on the relocation type)
+			if (target != nullptr ? rel->r_offset >= target->sh_size : !loaded(rel->r_offset, sizeof(elfptr_t)))
+				return RELOCATION;
+		}
+		return NONE;
+	}
+
+	/*! \brief Check relative relocation table (with all decoded targets) */
+	Error check_relr(uintptr_t offset, size_t size) const {
+		if (!_checked.inside(offset, size) || size % sizeof(typename Def::Relr) != 0 || !_checked.template aligned<typename Def::Relr>(offset))
+			return RELATIVE_RELOCATION;
+		const typename Def::Relr * relr = at<typename Def::Relr>(offset);
+		uintptr_t where = 0;
+		bool address = false;
+		for (size_t i = 0; i < size / sizeof(typename Def::Relr); i++) {
+			const elfptr_t value = relr[i].r_value;
+			if ((value & 1) == 0) {
+				if (!loaded(value, sizeof(elfptr_t)))
+					return RELATIVE_RELOCATION;
+				where = value + sizeof(elfptr_t);
+				address = true;
+			} else {
+				// A bitmap needs a preceding address entry
+				if (!address)
+					return RELATIVE_RELOCATION;
+				for (elfptr_t bitmap = value >> 1; bitmap != 0; bitmap &= bitmap - 1)
+					if (!loaded(where + ELF_Def::Builtin::ctz(bitmap) * sizeof(elfptr_t), sizeof(elfptr_t)))
+						return RELATIVE_RELOCATION;
+				where += (8 * sizeof(elfptr_t) - 1) * sizeof(elfptr_t);
+			}
+		}
+		return NONE;
+	}
+
+	/*! \brief Check version definition or version needed table (chains and names)
+	 * \param offset file offset of the table
+	 * \param size size (limit) of the table
+	 * \param strsize size of the associated string table
+	 * \param definition version definition (instead of version needed) table
+	 * \param count number of entries (or `0` to follow the chain until its end)
+	 */
+	Error check_versions(uintptr_t offset, size_t size, size_t strsize, bool definition, size_t count = 0) const {
+		if (!_checked.inside(offset, size))
+			return VERSION;
+		// Offsets are relative to the current entry and limited by the table
+		uintptr_t entry = 0;
+		for (size_t entries = 0; ; entries++) {
+			if (entries > size || entry > size)
+				return VERSION;
+			uint32_t aux, auxiliaries, next;
+			if (definition) {
+				if (sizeof(typename Def::Verdef) > size - entry || !_checked.template aligned<typename Def::Verdef>(offset + entry))
+					return VERSION;
+				const auto * verdef = at<typename Def::Verdef>(offset + entry);
+				aux = verdef->vd_aux;
+				auxiliaries = verdef->vd_cnt;
+				next = verdef->vd_next;
+			} else {
+				if (sizeof(typename Def::Verneed) > size - entry || !_checked.template aligned<typename Def::Verneed>(offset + entry))
+					return VERSION;
+				const auto * verneed = at<typename Def::Verneed>(offset + entry);
+				if (verneed->vn_file >= strsize)
+					return VERSION;
+				aux = verneed->vn_aux;
+				auxiliaries = verneed->vn_cnt;
+				next = verneed->vn_next;
+			}
+
+			// Auxiliary entries
+			uintptr_t a = entry;
+			for (uint32_t i = 0; i < auxiliaries; i++) {
+				const size_t aux_size = definition ? sizeof(typename Def::Verdaux) : sizeof(typename Def::Vernaux);
+				if (aux > size - a || aux_size > size - a - aux)
+					return VERSION;
+				a += aux;
+				if (!(definition ? _checked.template aligned<typename Def::Verdaux>(offset + a) : _checked.template aligned<typename Def::Vernaux>(offset + a)))
+					return VERSION;
+				uint32_t name;
+				if (definition) {
+					const auto * verdaux = at<typename Def::Verdaux>(offset + a);
+					name = verdaux->vda_name;
+					aux = verdaux->vda_next;
+				} else {
+					const auto * vernaux = at<typename Def::Vernaux>(offset + a);
+					name = vernaux->vna_name;
+					aux = vernaux->vna_next;
+				}
+				if (name >= strsize)
+					return VERSION;
+				if (aux == 0)
+					break;
+			}
+
+			if (next == 0 || entries + 1 == count)
+				return NONE;
+			if (next > size - entry)
+				return VERSION;
+			entry += next;
+		}
+	}
+
+	/*! \brief Check notes (sizes within the section) */
+	Error check_notes(uintptr_t offset, size_t size) const {
+		if (!_checked.inside(offset, size))
+			return NOTE;
+		const size_t align = 4;
+		for (size_t pos = 0; pos < size; ) {
+			if (sizeof(typename Def::Nhdr) > size - pos || !_checked.template aligned<typename Def::Nhdr>(offset + pos))
+				return NOTE;
+			const auto * nhdr = at<typename Def::Nhdr>(offset + pos);
+			pos += sizeof(typename Def::Nhdr);
+			const size_t name = (static_cast<size_t>(nhdr->n_namesz) + align - 1) & ~(align - 1);
+			const size_t desc = (static_cast<size_t>(nhdr->n_descsz) + align - 1) & ~(align - 1);
+			if (name > size - pos || desc > size - pos - name)
+				return NOTE;
+			pos += name + desc;
+		}
+		return NONE;
+	}
+
+	/*! \brief Check dynamic segment and the tables and strings referenced by it */
+	Error check_dynamic() const {
+		for (const auto & segment : _checked._elf.segments) {
+			if (segment.type() != Def::PT_DYNAMIC)
+				continue;
+			if (!_checked.inside(segment.offset(), segment.size()) || segment.size() < sizeof(typename Def::Dyn)
+			 || !_checked.template aligned<typename Def::Dyn>(segment.offset()))
+				return DYNAMIC;
+			const auto * dyn = at<typename Def::Dyn>(segment.offset());
+			const size_t entries = segment.size() / sizeof(typename Def::Dyn);
+
+			// Collect values -- the accessors of the dynamic table do not agree on which occurrence of a tag counts,
+			// hence (except for `DT_NEEDED`) each well-known tag may only occur once
+			uintptr_t value[Def::DT_NUM] = {};
+			bool present[Def::DT_NUM] = {};
+			uintptr_t version[Def::DT_VERNEEDNUM - Def::DT_VERSYM + 1] = {};
+			bool has_version[Def::DT_VERNEEDNUM - Def::DT_VERSYM + 1] = {};
+			uintptr_t gnu_hash = 0;
+			bool has_gnu_hash = false;
+			bool terminated = false;
+			for (size_t i = 0; i < entries && !terminated; i++) {
+				const auto tag = dyn[i].d_tag;
+				if (tag == Def::DT_NULL) {
+					terminated = true;
+				} else if (tag == Def::DT_NEEDED) {
+					present[Def::DT_NEEDED] = true;
+				} else if (tag > 0 && static_cast<size_t>(tag) < Def::DT_NUM) {
+					if (present[static_cast<size_t>(tag)])
+						return DYNAMIC;
+					present[static_cast<size_t>(tag)] = true;
+					value[static_cast<size_t>(tag)] = dyn[i].d_un.d_val;
+				} else if (tag == Def::DT_GNU_HASH) {
+					if (has_gnu_hash)
+						return DYNAMIC;
+					has_gnu_hash = true;
+					gnu_hash = dyn[i].d_un.d_val;
+				} else if (tag >= Def::DT_VERSYM && tag <= Def::DT_VERNEEDNUM) {
+					const size_t v = static_cast<size_t>(tag - Def::DT_VERSYM);
+					if (has_version[v])
+						return DYNAMIC;
+					has_version[v] = true;
+					version[v] = dyn[i].d_un.d_val;
+				}
+			}
+			if (!terminated)
+				return DYNAMIC;
+
+			// String table and the names referenced by the dynamic table
+			uintptr_t strtab = 0;
+			if (present[Def::DT_STRTAB] != present[Def::DT_STRSZ]
+			 || (present[Def::DT_STRTAB] && (!in_file(value[Def::DT_STRTAB], value[Def::DT_STRSZ], strtab)
+			                                 || value[Def::DT_STRSZ] == 0 || *at<char>(strtab + value[Def::DT_STRSZ] - 1) != '\0')))
+				return DYNAMIC;
+			for (size_t i = 0; i < entries && dyn[i].d_tag != Def::DT_NULL; i++)
+				switch (dyn[i].d_tag) {
+					case Def::DT_NEEDED:
+					case Def::DT_SONAME:
+					case Def::DT_RPATH:
+					case Def::DT_RUNPATH:
+						if (!present[Def::DT_STRTAB] || dyn[i].d_un.d_val >= value[Def::DT_STRSZ])
+							return DYNAMIC;
+						break;
+
+					default:
+						break;
+				}
+
+			// Number of dynamic symbols (from the hash tables)
+			uintptr_t offset = 0;
+			size_t symbols = 0;
+			if (present[Def::DT_HASH]) {
+				if (!in_file(value[Def::DT_HASH], 2 * sizeof(uint32_t), offset) || check_hash(offset, _checked._size - offset, 0) != NONE)
+					return HASH_TABLE;
+				symbols = at<uint32_t>(offset)[1];
+			}
+			if (has_gnu_hash) {
+				size_t covered = 0;
+				if (!in_file(gnu_hash, sizeof(ELF_Def::GnuHash_header), offset) || !_checked.gnu_hash_size(offset, _checked._size - offset, covered))
+					return GNU_HASH_TABLE;
+				if (symbols == 0)
+					symbols = covered;
+				else if (covered > symbols)
+					return GNU_HASH_TABLE;
+			}
+			// Number of symbols known to have a version index
+			size_t versioned = symbols;
+
+			// Symbol table (names and size from the hash table)
+			if (present[Def::DT_SYMTAB]) {
+				if (present[Def::DT_SYMENT] && value[Def::DT_SYMENT] != sizeof(typename Def::Sym))
+					return SYMBOL_TABLE;
+				if (!in_file(value[Def::DT_SYMTAB], symbols * sizeof(typename Def::Sym), offset))
+					return SYMBOL_TABLE;
+				const auto * sym = at<typename Def::Sym>(offset);
+				for (size_t i = 0; i < symbols; i++)
+					if (!present[Def::DT_STRTAB] || sym[i].st_name >= value[Def::DT_STRSZ])
+						return SYMBOL_TABLE;
+
+				// The GNU hash table does not cover undefined symbols (and hence gives only a lower bound)
+				if (!present[Def::DT_HASH]) {
+					symbols = (_checked._size - offset) / sizeof(typename Def::Sym);
+					for (const auto & section : _checked._elf.sections)
+						if (section.type() == SHT_DYNSYM && section.virt_addr() == value[Def::DT_SYMTAB])
+							versioned = symbols = section.entries();
+				}
+			}
+
+			// Relocation tables
+			const struct {
+				typename Def::dyn_tag table, size, entsize;
+				size_t expected;
+			} relocations[] = {
+				{ Def::DT_REL, Def::DT_RELSZ, Def::DT_RELENT, sizeof(typename Def::Rel) },
+				{ Def::DT_RELA, Def::DT_RELASZ, Def::DT_RELAENT, sizeof(typename Def::Rela) },
+				{ Def::DT_JMPREL, Def::DT_PLTRELSZ, Def::DT_NULL, value[Def::DT_PLTREL] == static_cast<uintptr_t>(Def::DT_RELA) ? sizeof(typename Def::Rela) : sizeof(typename Def::Rel) }
+			};
+			for (const auto & r : relocations)
+				if (present[r.table]) {
+					if (r.entsize != Def::DT_NULL && present[r.entsize] && value[r.entsize] != r.expected)
+						return RELOCATION;
+					if (!in_file(value[r.table], value[r.size], offset)
+					 || check_relocations(offset, value[r.size], r.expected, symbols, nullptr) != NONE)
+						return RELOCATION;
+				}
+			if (present[Def::DT_RELR]) {
+				if ((present[Def::DT_RELRENT] && value[Def::DT_RELRENT] != sizeof(typename Def::Relr))
+				 || !in_file(value[Def::DT_RELR], value[Def::DT_RELRSZ], offset)
+				 || check_relr(offset, value[Def::DT_RELRSZ]) != NONE)
+					return RELATIVE_RELOCATION;
+			}
+
+			// Version tables (`DT_VERSYM` is the first slot; definition and needed tables are limited by the file and their number of entries)
+			if (has_version[0]) {
+				if (!present[Def::DT_SYMTAB] || !in_file(version[0], versioned * sizeof(uint16_t), offset)
+				 || !_checked.template aligned<uint16_t>(offset))
+					return VERSION;
+			}
+			const struct {
+				typename Def::dyn_tag table, count;
+			} versions[] = {
+				{ Def::DT_VERDEF, Def::DT_VERDEFNUM },
+				{ Def::DT_VERNEED, Def::DT_VERNEEDNUM }
+			};
+			for (const auto & v : versions) {
+				const size_t table = static_cast<size_t>(v.table - Def::DT_VERSYM);
+				const size_t count = static_cast<size_t>(v.count - Def::DT_VERSYM);
+				if (has_version[table] != has_version[count])
+					return VERSION;
+				if (has_version[table]
+				 && (!present[Def::DT_STRTAB] || !in_file(version[table], 0, offset)
+				  || check_versions(offset, _checked._size - offset, value[Def::DT_STRSZ], v.table == Def::DT_VERDEF, version[count]) != NONE))
+					return VERSION;
+			}
+
+			// Initialization and finalization function arrays
+			const struct {
+				typename Def::dyn_tag table, size;
+			} arrays[] = {
+				{ Def::DT_INIT_ARRAY, Def::DT_INIT_ARRAYSZ },
+				{ Def::DT_FINI_ARRAY, Def::DT_FINI_ARRAYSZ },
+				{ Def::DT_PREINIT_ARRAY, Def::DT_PREINIT_ARRAYSZ }
+			};
+			for (const auto & a : arrays)
+				if (present[a.table] && !in_file(value[a.table], value[a.size], offset))
+					return DYNAMIC;
+		}
+		return NONE;
+	}
+};
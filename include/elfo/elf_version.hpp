@@ -0,0 +1,217 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#include "elf.hpp"
+
+/*! \brief Precomputed table of version needed and version definition entries
+ * Built once into caller-provided memory, offering
+ * index-to-name lookup using a dense array (indexed by version index) and
+ * name-to-index lookup using a small hash table (with the hash values stored in the ELF file).
+ * \tparam C 32- or 64-bit elf class
+ */
+template<ELFCLASS C>
+class VersionTable : private ELF_Def::Constants {
+	using DynamicTable = typename ELF<C>::DynamicTable;
+	using VersionNeeded = typename ELF<C>::VersionNeeded;
+	using VersionDefinition = typename ELF<C>::VersionDefinition;
+	template<typename T>
+	using List = typename ELF<C>::template List<T>;
+
+	/*! \brief Number of hash buckets */
+	static const size_t buckets = 32;
+
+ public:
+	/*! \brief Version entry */
+	struct Entry {
+		/*! \brief Version name (or `nullptr` if index is not used) */
+		const char * name;
+		/*! \brief Dependency file name (for version needed) or `nullptr` (for version definition) */
+		const char * file;
+		/*! \brief ELF hash value of version name */
+		uint32_t hash;
+		/*! \brief Next version index in hash bucket (or 0) */
+		uint16_t next;
+		/*! \brief Weak version */
+		bool weak;
+	};
+
+	/*! \brief Number of entries required for the version table
+	 * \param needed version needed list
+	 * \param definitions version definition list
+	 * \return highest version index + 1
+	 */
+	static size_t entries(const List<VersionNeeded> & needed, const List<VersionDefinition> & definitions) {
+		size_t max = VER_NDX_GLOBAL;
+		for (const auto & v : needed)
+			for (const auto & aux : v.auxiliary())
+				if ((aux.version_index() & 0x7fff) > max)
+					max = aux.version_index() & 0x7fff;
+		for (const auto & v : definitions)
+			if (!v.base() && (v.version_index() & 0x7fff) > max)
+				max = v.version_index() & 0x7fff;
+		return max + 1;
+	}
+
+	/*! \brief Number of entries required for the version table
+	 * \param dynamic dynamic table
+	 * \return highest version index + 1
+	 */
+	static size_t entries(const DynamicTable & dynamic) {
+		return entries(dynamic.get_version_needed(), dynamic.get_version_definition());
+	}
+
+	/*! \brief Build version table
+	 * \param needed version needed list
+	 * \param definitions version definition list
+	 * \param buffer memory for the entries (must stay valid while this object is used)
+	 * \param size number of entries in buffer (should be at least \ref entries, otherwise the table is not \ref complete)
+	 */
+	VersionTable(const List<VersionNeeded> & needed, const List<VersionDefinition> & definitions, Entry * buffer, size_t size)
+	  : _entry(buffer), _size(size), _complete(true) {
+		for (size_t i = 0; i < _size; i++)
+			_entry[i] = { nullptr, nullptr, 0, 0, false };
+		for (size_t b = 0; b < buckets; b++)
+			_bucket[b] = 0;
+
+		// Insertion order (needed before definitions) is preserved for name lookups
+		for (const auto & v : needed)
+			for (const auto & aux : v.auxiliary())
+				insert(aux.version_index() & 0x7fff, aux.name(), v.file(), aux.hash(), aux.weak());
+		for (const auto & v : definitions)
+			if (!v.base())
+				insert(v.version_index() & 0x7fff, v.auxiliary()[0].name(), nullptr, v.hash(), v.weak());
+	}
+
+	/*! \brief Build version table
+	 * \param dynamic dynamic table
+	 * \param buffer memory for the entries (must stay valid while this object is used)
+	 * \param size number of entries in buffer (should be at least \ref entries, otherwise the table is not \ref complete)
+	 */
+	VersionTable(const DynamicTable & dynamic, Entry * buffer, size_t size)
+	  : VersionTable(dynamic.get_version_needed(), dynamic.get_version_definition(), buffer, size) {}
+
+	/*! \brief Have all versions been stored in the table?
+	 * \return `false` if the buffer was too small
+	 */
+	bool complete() const {
+		return _complete;
+	}
+
+	/*! \brief Get version entry
+	 * \param index version index (hidden bit is ignored)
+	 * \return pointer to entry or `nullptr` if not available
+	 */
+	const Entry * entry(uint16_t index) const {
+		index &= 0x7fff;
+		return index < _size && _entry[index].name != nullptr ? _entry + index : nullptr;
+	}
+
+	/*! \brief Get version name
+	 * \param index version index (hidden bit is ignored)
+	 * \return version name or `nullptr` if not available (or reserved index)
+	 */
+	const char * name(uint16_t index) const {
+		const Entry * e = entry(index);
+		return e == nullptr ? nullptr : e->name;
+	}
+
+	/*! \brief Get version index
+	 * \param name version name
+	 * \param hash ELF hash value of version name
+	 * \return version index or VER_NDX_GLOBAL if not available
+	 */
+	uint16_t index(const char * name, uint32_t hash) const {
+		for (uint16_t i = _bucket[hash % buckets]; i != 0; i = _entry[i].next)
+			if (_entry[i].hash == hash && strcmp(name, _entry[i].name) == 0)
+				return i;
+		return VER_NDX_GLOBAL;
+	}
+
+	/*! \brief Get version index
+	 * \param name version name
+	 * \return version index or VER_NDX_GLOBAL if not available
+	 */
+	uint16_t index(const char * name) const {
+		return index(name, ELF_Def::hash(name));
+	}
+
+	/*! \brief Get version index of a version definition (ignoring needed versions)
+	 * \param name version name
+	 * \param hash ELF hash value of version name
+	 * \return version index or VER_NDX_GLOBAL if not defined
+	 */
+	uint16_t definition(const char * name, uint32_t hash) const {
+		for (uint16_t i = _bucket[hash % buckets]; i != 0; i = _entry[i].next)
+			if (_entry[i].file == nullptr && _entry[i].hash == hash && strcmp(name, _entry[i].name) == 0)
+				return i;
+		return VER_NDX_GLOBAL;
+	}
+
+	/*! \brief Check multiple entries of a version symbol table (`SHT_GNU_VERSYM`) against the required versions
+	 * Same semantics as the version check in \ref ELF::SymbolTable::index:
+	 * Unversioned symbols and VER_NDX_GLOBAL as required version always match,
+	 * \ref ELF::SymbolTable::default_version matches all versions not marked as hidden.
+	 * \param versym version symbol table entries (or `nullptr` if the object has no version table, hence all entries match)
+	 * \param required_versions required versions (one per entry)
+	 * \param n number of entries
+	 * \param results array (with at least `n` elements) to store the result of the check for each entry
+	 * \return number of matching entries
+	 */
+	static size_t check(const uint16_t * versym, const uint16_t * required_versions, size_t n, bool * results) {
+		if (versym == nullptr) {
+			for (size_t i = 0; i < n; i++)
+				results[i] = true;
+			return n;
+		}
+		size_t matches = 0;
+		for (size_t i = 0; i < n; i++) {
+			const uint16_t version = versym[i] & 0x7fff;
+			const bool hidden = (versym[i] & 0x8000) != 0;
+			const uint16_t required = required_versions[i];
+			results[i] = (required == VER_NDX_GLOBAL) | (version == VER_NDX_GLOBAL) | (version == required)
+			           | ((required == ELF<C>::SymbolTable::default_version) & !hidden);
+			matches += results[i] ? 1 : 0;
+		}
+		return matches;
+	}
+
+ private:
+	/*! \brief Entries (indexed by version index) */
+	Entry * const _entry;
+
+	/*! \brief Number of entries */
+	const size_t _size;
+
+	/*! \brief All versions are stored */
+	bool _complete;
+
+	/*! \brief First version index in each hash bucket (or 0) */
+	uint16_t _bucket[buckets];
+
+	/*! \brief Insert version
+	 * \param index version index
+	 * \param name version name
+	 * \param file dependency file name (or `nullptr`)
+	 * \param hash ELF hash value of version name
+	 * \param weak weak version
+	 */
+	void insert(uint16_t index, const char * name, const char * file, uint32_t hash, bool weak) {
+		if (index <= VER_NDX_GLOBAL || (index < _size && _entry[index].name != nullptr)) {
+			// Reserved or already used index
+			return;
+		} else if (index >= _size) {
+			_complete = false;
+			return;
+		}
+		_entry[index] = { name, file, hash, 0, weak };
+
+		// Append to bucket
+		uint16_t * next = _bucket + hash % buckets;
+		while (*next != 0)
+			next = &_entry[*next].next;
+		*next = index;
+	}
+};
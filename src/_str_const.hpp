@@ -0,0 +1,776 @@
+
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#ifdef USE_DLH
+#include <dlh/types.hpp>
+#include <dlh/stream/buffer.hpp>
+#include <dlh/utility.hpp>
+using ostream = BufferStream;
+#else
+#include <cstdint>
+#include <ostream>
+using std::ostream;
+#endif
+
+#include "elfo/elf_def/const.hpp"
+
+#ifndef _ENUM_VALUE
+#define _ENUM_VALUE 1
+static bool _enum_value = false;
+inline ostream& enum_value_show(ostream& os) { _enum_value = true; return os; }
+inline ostream& enum_value_hide(ostream& os) { _enum_value = false; return os; }
+#endif
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::ehdr_type val) {
+	switch(val) {
+		case ELF_Def::Constants::ehdr_type::ET_NONE: return os << (_enum_value ? "ET_NONE (0)" : "ET_NONE");
+		case ELF_Def::Constants::ehdr_type::ET_REL: return os << (_enum_value ? "ET_REL (1)" : "ET_REL");
+		case ELF_Def::Constants::ehdr_type::ET_EXEC: return os << (_enum_value ? "ET_EXEC (2)" : "ET_EXEC");
+		case ELF_Def::Constants::ehdr_type::ET_DYN: return os << (_enum_value ? "ET_DYN (3)" : "ET_DYN");
+		case ELF_Def::Constants::ehdr_type::ET_CORE: return os << (_enum_value ? "ET_CORE (4)" : "ET_CORE");
+		case ELF_Def::Constants::ehdr_type::ET_LOOS: return os << (_enum_value ? "ET_LOOS (0xfe00)" : "ET_LOOS");
+		case ELF_Def::Constants::ehdr_type::ET_HIOS: return os << (_enum_value ? "ET_HIOS (0xfeff)" : "ET_HIOS");
+		case ELF_Def::Constants::ehdr_type::ET_LOPROC: return os << (_enum_value ? "ET_LOPROC (0xff00)" : "ET_LOPROC");
+		case ELF_Def::Constants::ehdr_type::ET_HIPROC: return os << (_enum_value ? "ET_HIPROC (0xffff)" : "ET_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::ehdr_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::ehdr_type _enum_values_ehdr_type[] = {ELF_Def::Constants::ehdr_type ::ET_CORE , ELF_Def::Constants::ehdr_type ::ET_DYN , ELF_Def::Constants::ehdr_type ::ET_EXEC , ELF_Def::Constants::ehdr_type ::ET_HIOS , ELF_Def::Constants::ehdr_type ::ET_HIPROC , ELF_Def::Constants::ehdr_type ::ET_LOOS , ELF_Def::Constants::ehdr_type ::ET_LOPROC , ELF_Def::Constants::ehdr_type ::ET_NONE , ELF_Def::Constants::ehdr_type ::ET_REL };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::ehdr_machine val) {
+	switch(val) {
+		case ELF_Def::Constants::ehdr_machine::EM_NONE: return os << (_enum_value ? "EM_NONE (0)" : "EM_NONE");
+		case ELF_Def::Constants::ehdr_machine::EM_M32: return os << (_enum_value ? "EM_M32 (1)" : "EM_M32");
+		case ELF_Def::Constants::ehdr_machine::EM_SPARC: return os << (_enum_value ? "EM_SPARC (2)" : "EM_SPARC");
+		case ELF_Def::Constants::ehdr_machine::EM_386: return os << (_enum_value ? "EM_386 (3)" : "EM_386");
+		case ELF_Def::Constants::ehdr_machine::EM_68K: return os << (_enum_value ? "EM_68K (4)" : "EM_68K");
+		case ELF_Def::Constants::ehdr_machine::EM_88K: return os << (_enum_value ? "EM_88K (5)" : "EM_88K");
+		case ELF_Def::Constants::ehdr_machine::EM_486: return os << (_enum_value ? "EM_486 (6)" : "EM_486");
+		case ELF_Def::Constants::ehdr_machine::EM_860: return os << (_enum_value ? "EM_860 (7)" : "EM_860");
+		case ELF_Def::Constants::ehdr_machine::EM_MIPS: return os << (_enum_value ? "EM_MIPS (8)" : "EM_MIPS");
+		case ELF_Def::Constants::ehdr_machine::EM_S370: return os << (_enum_value ? "EM_S370 (9)" : "EM_S370");
+		case ELF_Def::Constants::ehdr_machine::EM_MIPS_RS3_LE: return os << (_enum_value ? "EM_MIPS_RS3_LE (10)" : "EM_MIPS_RS3_LE");
+		case ELF_Def::Constants::ehdr_machine::EM_PARISC: return os << (_enum_value ? "EM_PARISC (15)" : "EM_PARISC");
+		case ELF_Def::Constants::ehdr_machine::EM_VPP550: return os << (_enum_value ? "EM_VPP550 (17)" : "EM_VPP550");
+		case ELF_Def::Constants::ehdr_machine::EM_SPARC32PLUS: return os << (_enum_value ? "EM_SPARC32PLUS (18)" : "EM_SPARC32PLUS");
+		case ELF_Def::Constants::ehdr_machine::EM_960: return os << (_enum_value ? "EM_960 (19)" : "EM_960");
+		case ELF_Def::Constants::ehdr_machine::EM_PPC: return os << (_enum_value ? "EM_PPC (20)" : "EM_PPC");
+		case ELF_Def::Constants::ehdr_machine::EM_PPC64: return os << (_enum_value ? "EM_PPC64 (21)" : "EM_PPC64");
+		case ELF_Def::Constants::ehdr_machine::EM_S390: return os << (_enum_value ? "EM_S390 (22)" : "EM_S390");
+		case ELF_Def::Constants::ehdr_machine::EM_SPU: return os << (_enum_value ? "EM_SPU (23)" : "EM_SPU");
+		case ELF_Def::Constants::ehdr_machine::EM_V800: return os << (_enum_value ? "EM_V800 (36)" : "EM_V800");
+		case ELF_Def::Constants::ehdr_machine::EM_FR20: return os << (_enum_value ? "EM_FR20 (37)" : "EM_FR20");
+		case ELF_Def::Constants::ehdr_machine::EM_RH32: return os << (_enum_value ? "EM_RH32 (38)" : "EM_RH32");
+		case ELF_Def::Constants::ehdr_machine::EM_MCORE: return os << (_enum_value ? "EM_MCORE (39)" : "EM_MCORE");
+		case ELF_Def::Constants::ehdr_machine::EM_ARM: return os << (_enum_value ? "EM_ARM (40)" : "EM_ARM");
+		case ELF_Def::Constants::ehdr_machine::EM_OLD_ALPHA: return os << (_enum_value ? "EM_OLD_ALPHA (41)" : "EM_OLD_ALPHA");
+		case ELF_Def::Constants::ehdr_machine::EM_SH: return os << (_enum_value ? "EM_SH (42)" : "EM_SH");
+		case ELF_Def::Constants::ehdr_machine::EM_SPARCV9: return os << (_enum_value ? "EM_SPARCV9 (43)" : "EM_SPARCV9");
+		case ELF_Def::Constants::ehdr_machine::EM_TRICORE: return os << (_enum_value ? "EM_TRICORE (44)" : "EM_TRICORE");
+		case ELF_Def::Constants::ehdr_machine::EM_ARC: return os << (_enum_value ? "EM_ARC (45)" : "EM_ARC");
+		case ELF_Def::Constants::ehdr_machine::EM_H8_300: return os << (_enum_value ? "EM_H8_300 (46)" : "EM_H8_300");
+		case ELF_Def::Constants::ehdr_machine::EM_H8_300H: return os << (_enum_value ? "EM_H8_300H (47)" : "EM_H8_300H");
+		case ELF_Def::Constants::ehdr_machine::EM_H8S: return os << (_enum_value ? "EM_H8S (48)" : "EM_H8S");
+		case ELF_Def::Constants::ehdr_machine::EM_H8_500: return os << (_enum_value ? "EM_H8_500 (49)" : "EM_H8_500");
+		case ELF_Def::Constants::ehdr_machine::EM_IA_64: return os << (_enum_value ? "EM_IA_64 (50)" : "EM_IA_64");
+		case ELF_Def::Constants::ehdr_machine::EM_MIPS_X: return os << (_enum_value ? "EM_MIPS_X (51)" : "EM_MIPS_X");
+		case ELF_Def::Constants::ehdr_machine::EM_COLDFIRE: return os << (_enum_value ? "EM_COLDFIRE (52)" : "EM_COLDFIRE");
+		case ELF_Def::Constants::ehdr_machine::EM_68HC12: return os << (_enum_value ? "EM_68HC12 (53)" : "EM_68HC12");
+		case ELF_Def::Constants::ehdr_machine::EM_MMA: return os << (_enum_value ? "EM_MMA (54)" : "EM_MMA");
+		case ELF_Def::Constants::ehdr_machine::EM_PCP: return os << (_enum_value ? "EM_PCP (55)" : "EM_PCP");
+		case ELF_Def::Constants::ehdr_machine::EM_NCPU: return os << (_enum_value ? "EM_NCPU (56)" : "EM_NCPU");
+		case ELF_Def::Constants::ehdr_machine::EM_NDR1: return os << (_enum_value ? "EM_NDR1 (57)" : "EM_NDR1");
+		case ELF_Def::Constants::ehdr_machine::EM_STARCORE: return os << (_enum_value ? "EM_STARCORE (58)" : "EM_STARCORE");
+		case ELF_Def::Constants::ehdr_machine::EM_ME16: return os << (_enum_value ? "EM_ME16 (59)" : "EM_ME16");
+		case ELF_Def::Constants::ehdr_machine::EM_ST100: return os << (_enum_value ? "EM_ST100 (60)" : "EM_ST100");
+		case ELF_Def::Constants::ehdr_machine::EM_TINYJ: return os << (_enum_value ? "EM_TINYJ (61)" : "EM_TINYJ");
+		case ELF_Def::Constants::ehdr_machine::EM_X86_64: return os << (_enum_value ? "EM_X86_64 (62)" : "EM_X86_64");
+		case ELF_Def::Constants::ehdr_machine::EM_PDSP: return os << (_enum_value ? "EM_PDSP (63)" : "EM_PDSP");
+		case ELF_Def::Constants::ehdr_machine::EM_PDP10: return os << (_enum_value ? "EM_PDP10 (64)" : "EM_PDP10");
+		case ELF_Def::Constants::ehdr_machine::EM_PDP11: return os << (_enum_value ? "EM_PDP11 (65)" : "EM_PDP11");
+		case ELF_Def::Constants::ehdr_machine::EM_FX66: return os << (_enum_value ? "EM_FX66 (66)" : "EM_FX66");
+		case ELF_Def::Constants::ehdr_machine::EM_ST9PLUS: return os << (_enum_value ? "EM_ST9PLUS (67)" : "EM_ST9PLUS");
+		case ELF_Def::Constants::ehdr_machine::EM_ST7: return os << (_enum_value ? "EM_ST7 (68)" : "EM_ST7");
+		case ELF_Def::Constants::ehdr_machine::EM_68HC16: return os << (_enum_value ? "EM_68HC16 (69)" : "EM_68HC16");
+		case ELF_Def::Constants::ehdr_machine::EM_68HC11: return os << (_enum_value ? "EM_68HC11 (70)" : "EM_68HC11");
+		case ELF_Def::Constants::ehdr_machine::EM_68HC08: return os << (_enum_value ? "EM_68HC08 (71)" : "EM_68HC08");
+		case ELF_Def::Constants::ehdr_machine::EM_68HC05: return os << (_enum_value ? "EM_68HC05 (72)" : "EM_68HC05");
+		case ELF_Def::Constants::ehdr_machine::EM_SVX: return os << (_enum_value ? "EM_SVX (73)" : "EM_SVX");
+		case ELF_Def::Constants::ehdr_machine::EM_ST19: return os << (_enum_value ? "EM_ST19 (74)" : "EM_ST19");
+		case ELF_Def::Constants::ehdr_machine::EM_VAX: return os << (_enum_value ? "EM_VAX (75)" : "EM_VAX");
+		case ELF_Def::Constants::ehdr_machine::EM_CRIS: return os << (_enum_value ? "EM_CRIS (76)" : "EM_CRIS");
+		case ELF_Def::Constants::ehdr_machine::EM_JAVELIN: return os << (_enum_value ? "EM_JAVELIN (77)" : "EM_JAVELIN");
+		case ELF_Def::Constants::ehdr_machine::EM_FIREPATH: return os << (_enum_value ? "EM_FIREPATH (78)" : "EM_FIREPATH");
+		case ELF_Def::Constants::ehdr_machine::EM_ZSP: return os << (_enum_value ? "EM_ZSP (79)" : "EM_ZSP");
+		case ELF_Def::Constants::ehdr_machine::EM_MMIX: return os << (_enum_value ? "EM_MMIX (80)" : "EM_MMIX");
+		case ELF_Def::Constants::ehdr_machine::EM_HUANY: return os << (_enum_value ? "EM_HUANY (81)" : "EM_HUANY");
+		case ELF_Def::Constants::ehdr_machine::EM_PRISM: return os << (_enum_value ? "EM_PRISM (82)" : "EM_PRISM");
+		case ELF_Def::Constants::ehdr_machine::EM_AVR: return os << (_enum_value ? "EM_AVR (83)" : "EM_AVR");
+		case ELF_Def::Constants::ehdr_machine::EM_FR30: return os << (_enum_value ? "EM_FR30 (84)" : "EM_FR30");
+		case ELF_Def::Constants::ehdr_machine::EM_D10V: return os << (_enum_value ? "EM_D10V (85)" : "EM_D10V");
+		case ELF_Def::Constants::ehdr_machine::EM_D30V: return os << (_enum_value ? "EM_D30V (86)" : "EM_D30V");
+		case ELF_Def::Constants::ehdr_machine::EM_V850: return os << (_enum_value ? "EM_V850 (87)" : "EM_V850");
+		case ELF_Def::Constants::ehdr_machine::EM_M32R: return os << (_enum_value ? "EM_M32R (88)" : "EM_M32R");
+		case ELF_Def::Constants::ehdr_machine::EM_MN10300: return os << (_enum_value ? "EM_MN10300 (89)" : "EM_MN10300");
+		case ELF_Def::Constants::ehdr_machine::EM_MN10200: return os << (_enum_value ? "EM_MN10200 (90)" : "EM_MN10200");
+		case ELF_Def::Constants::ehdr_machine::EM_PJ: return os << (_enum_value ? "EM_PJ (91)" : "EM_PJ");
+		case ELF_Def::Constants::ehdr_machine::EM_OPENRISC: return os << (_enum_value ? "EM_OPENRISC (92)" : "EM_OPENRISC");
+		case ELF_Def::Constants::ehdr_machine::EM_ARC_A5: return os << (_enum_value ? "EM_ARC_A5 (93)" : "EM_ARC_A5");
+		case ELF_Def::Constants::ehdr_machine::EM_XTENSA: return os << (_enum_value ? "EM_XTENSA (94)" : "EM_XTENSA");
+		case ELF_Def::Constants::ehdr_machine::EM_VIDEOCORE: return os << (_enum_value ? "EM_VIDEOCORE (95)" : "EM_VIDEOCORE");
+		case ELF_Def::Constants::ehdr_machine::EM_TMM_GPP: return os << (_enum_value ? "EM_TMM_GPP (96)" : "EM_TMM_GPP");
+		case ELF_Def::Constants::ehdr_machine::EM_NS32K: return os << (_enum_value ? "EM_NS32K (97)" : "EM_NS32K");
+		case ELF_Def::Constants::ehdr_machine::EM_TPC: return os << (_enum_value ? "EM_TPC (98)" : "EM_TPC");
+		case ELF_Def::Constants::ehdr_machine::EM_SNP1K: return os << (_enum_value ? "EM_SNP1K (99)" : "EM_SNP1K");
+		case ELF_Def::Constants::ehdr_machine::EM_ST200: return os << (_enum_value ? "EM_ST200 (100)" : "EM_ST200");
+		case ELF_Def::Constants::ehdr_machine::EM_IP2K: return os << (_enum_value ? "EM_IP2K (101)" : "EM_IP2K");
+		case ELF_Def::Constants::ehdr_machine::EM_MAX: return os << (_enum_value ? "EM_MAX (102)" : "EM_MAX");
+		case ELF_Def::Constants::ehdr_machine::EM_CR: return os << (_enum_value ? "EM_CR (103)" : "EM_CR");
+		case ELF_Def::Constants::ehdr_machine::EM_F2MC16: return os << (_enum_value ? "EM_F2MC16 (104)" : "EM_F2MC16");
+		case ELF_Def::Constants::ehdr_machine::EM_MSP430: return os << (_enum_value ? "EM_MSP430 (105)" : "EM_MSP430");
+		case ELF_Def::Constants::ehdr_machine::EM_BLACKFIN: return os << (_enum_value ? "EM_BLACKFIN (106)" : "EM_BLACKFIN");
+		case ELF_Def::Constants::ehdr_machine::EM_SE_C33: return os << (_enum_value ? "EM_SE_C33 (107)" : "EM_SE_C33");
+		case ELF_Def::Constants::ehdr_machine::EM_SEP: return os << (_enum_value ? "EM_SEP (108)" : "EM_SEP");
+		case ELF_Def::Constants::ehdr_machine::EM_ARCA: return os << (_enum_value ? "EM_ARCA (109)" : "EM_ARCA");
+		case ELF_Def::Constants::ehdr_machine::EM_UNICORE: return os << (_enum_value ? "EM_UNICORE (110)" : "EM_UNICORE");
+		case ELF_Def::Constants::ehdr_machine::EM_EXCESS: return os << (_enum_value ? "EM_EXCESS (111)" : "EM_EXCESS");
+		case ELF_Def::Constants::ehdr_machine::EM_DXP: return os << (_enum_value ? "EM_DXP (112)" : "EM_DXP");
+		case ELF_Def::Constants::ehdr_machine::EM_ALTERA_NIOS2: return os << (_enum_value ? "EM_ALTERA_NIOS2 (113)" : "EM_ALTERA_NIOS2");
+		case ELF_Def::Constants::ehdr_machine::EM_CRX: return os << (_enum_value ? "EM_CRX (114)" : "EM_CRX");
+		case ELF_Def::Constants::ehdr_machine::EM_XGATE: return os << (_enum_value ? "EM_XGATE (115)" : "EM_XGATE");
+		case ELF_Def::Constants::ehdr_machine::EM_C166: return os << (_enum_value ? "EM_C166 (116)" : "EM_C166");
+		case ELF_Def::Constants::ehdr_machine::EM_M16C: return os << (_enum_value ? "EM_M16C (117)" : "EM_M16C");
+		case ELF_Def::Constants::ehdr_machine::EM_DSPIC30F: return os << (_enum_value ? "EM_DSPIC30F (118)" : "EM_DSPIC30F");
+		case ELF_Def::Constants::ehdr_machine::EM_CE: return os << (_enum_value ? "EM_CE (119)" : "EM_CE");
+		case ELF_Def::Constants::ehdr_machine::EM_M32C: return os << (_enum_value ? "EM_M32C (120)" : "EM_M32C");
+		case ELF_Def::Constants::ehdr_machine::EM_TSK3000: return os << (_enum_value ? "EM_TSK3000 (131)" : "EM_TSK3000");
+		case ELF_Def::Constants::ehdr_machine::EM_RS08: return os << (_enum_value ? "EM_RS08 (132)" : "EM_RS08");
+		case ELF_Def::Constants::ehdr_machine::EM_ECOG2: return os << (_enum_value ? "EM_ECOG2 (134)" : "EM_ECOG2");
+		case ELF_Def::Constants::ehdr_machine::EM_SCORE: return os << (_enum_value ? "EM_SCORE (135)" : "EM_SCORE");
+		case ELF_Def::Constants::ehdr_machine::EM_DSP24: return os << (_enum_value ? "EM_DSP24 (136)" : "EM_DSP24");
+		case ELF_Def::Constants::ehdr_machine::EM_VIDEOCORE3: return os << (_enum_value ? "EM_VIDEOCORE3 (137)" : "EM_VIDEOCORE3");
+		case ELF_Def::Constants::ehdr_machine::EM_LATTICEMICO32: return os << (_enum_value ? "EM_LATTICEMICO32 (138)" : "EM_LATTICEMICO32");
+		case ELF_Def::Constants::ehdr_machine::EM_SE_C17: return os << (_enum_value ? "EM_SE_C17 (139)" : "EM_SE_C17");
+		case ELF_Def::Constants::ehdr_machine::EM_TI_C6000: return os << (_enum_value ? "EM_TI_C6000 (140)" : "EM_TI_C6000");
+		case ELF_Def::Constants::ehdr_machine::EM_TI_C2000: return os << (_enum_value ? "EM_TI_C2000 (141)" : "EM_TI_C2000");
+		case ELF_Def::Constants::ehdr_machine::EM_TI_C5500: return os << (_enum_value ? "EM_TI_C5500 (142)" : "EM_TI_C5500");
+		case ELF_Def::Constants::ehdr_machine::EM_MMDSP_PLUS: return os << (_enum_value ? "EM_MMDSP_PLUS (160)" : "EM_MMDSP_PLUS");
+		case ELF_Def::Constants::ehdr_machine::EM_CYPRESS_M8C: return os << (_enum_value ? "EM_CYPRESS_M8C (161)" : "EM_CYPRESS_M8C");
+		case ELF_Def::Constants::ehdr_machine::EM_R32C: return os << (_enum_value ? "EM_R32C (162)" : "EM_R32C");
+		case ELF_Def::Constants::ehdr_machine::EM_TRIMEDIA: return os << (_enum_value ? "EM_TRIMEDIA (163)" : "EM_TRIMEDIA");
+		case ELF_Def::Constants::ehdr_machine::EM_QDSP6: return os << (_enum_value ? "EM_QDSP6 (164)" : "EM_QDSP6");
+		case ELF_Def::Constants::ehdr_machine::EM_8051: return os << (_enum_value ? "EM_8051 (165)" : "EM_8051");
+		case ELF_Def::Constants::ehdr_machine::EM_STXP7X: return os << (_enum_value ? "EM_STXP7X (166)" : "EM_STXP7X");
+		case ELF_Def::Constants::ehdr_machine::EM_NDS32: return os << (_enum_value ? "EM_NDS32 (167)" : "EM_NDS32");
+		case ELF_Def::Constants::ehdr_machine::EM_ECOG1: return os << (_enum_value ? "EM_ECOG1 (168)" : "EM_ECOG1");
+		case ELF_Def::Constants::ehdr_machine::EM_MAXQ30: return os << (_enum_value ? "EM_MAXQ30 (169)" : "EM_MAXQ30");
+		case ELF_Def::Constants::ehdr_machine::EM_XIMO16: return os << (_enum_value ? "EM_XIMO16 (170)" : "EM_XIMO16");
+		case ELF_Def::Constants::ehdr_machine::EM_MANIK: return os << (_enum_value ? "EM_MANIK (171)" : "EM_MANIK");
+		case ELF_Def::Constants::ehdr_machine::EM_CRAYNV2: return os << (_enum_value ? "EM_CRAYNV2 (172)" : "EM_CRAYNV2");
+		case ELF_Def::Constants::ehdr_machine::EM_RX: return os << (_enum_value ? "EM_RX (173)" : "EM_RX");
+		case ELF_Def::Constants::ehdr_machine::EM_METAG: return os << (_enum_value ? "EM_METAG (174)" : "EM_METAG");
+		case ELF_Def::Constants::ehdr_machine::EM_MCST_ELBRUS: return os << (_enum_value ? "EM_MCST_ELBRUS (175)" : "EM_MCST_ELBRUS");
+		case ELF_Def::Constants::ehdr_machine::EM_ECOG16: return os << (_enum_value ? "EM_ECOG16 (176)" : "EM_ECOG16");
+		case ELF_Def::Constants::ehdr_machine::EM_CR16: return os << (_enum_value ? "EM_CR16 (177)" : "EM_CR16");
+		case ELF_Def::Constants::ehdr_machine::EM_ETPU: return os << (_enum_value ? "EM_ETPU (178)" : "EM_ETPU");
+		case ELF_Def::Constants::ehdr_machine::EM_SLE9X: return os << (_enum_value ? "EM_SLE9X (179)" : "EM_SLE9X");
+		case ELF_Def::Constants::ehdr_machine::EM_L1OM: return os << (_enum_value ? "EM_L1OM (180)" : "EM_L1OM");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL181: return os << (_enum_value ? "EM_INTEL181 (181)" : "EM_INTEL181");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL182: return os << (_enum_value ? "EM_INTEL182 (182)" : "EM_INTEL182");
+		case ELF_Def::Constants::ehdr_machine::EM_AVR32: return os << (_enum_value ? "EM_AVR32 (185)" : "EM_AVR32");
+		case ELF_Def::Constants::ehdr_machine::EM_STM8: return os << (_enum_value ? "EM_STM8 (186)" : "EM_STM8");
+		case ELF_Def::Constants::ehdr_machine::EM_TILE64: return os << (_enum_value ? "EM_TILE64 (187)" : "EM_TILE64");
+		case ELF_Def::Constants::ehdr_machine::EM_TILEPRO: return os << (_enum_value ? "EM_TILEPRO (188)" : "EM_TILEPRO");
+		case ELF_Def::Constants::ehdr_machine::EM_MICROBLAZE: return os << (_enum_value ? "EM_MICROBLAZE (189)" : "EM_MICROBLAZE");
+		case ELF_Def::Constants::ehdr_machine::EM_CUDA: return os << (_enum_value ? "EM_CUDA (190)" : "EM_CUDA");
+		case ELF_Def::Constants::ehdr_machine::EM_TILEGX: return os << (_enum_value ? "EM_TILEGX (191)" : "EM_TILEGX");
+		case ELF_Def::Constants::ehdr_machine::EM_CLOUDSHIELD: return os << (_enum_value ? "EM_CLOUDSHIELD (192)" : "EM_CLOUDSHIELD");
+		case ELF_Def::Constants::ehdr_machine::EM_COREA_1ST: return os << (_enum_value ? "EM_COREA_1ST (193)" : "EM_COREA_1ST");
+		case ELF_Def::Constants::ehdr_machine::EM_COREA_2ND: return os << (_enum_value ? "EM_COREA_2ND (194)" : "EM_COREA_2ND");
+		case ELF_Def::Constants::ehdr_machine::EM_ARC_COMPACT2: return os << (_enum_value ? "EM_ARC_COMPACT2 (195)" : "EM_ARC_COMPACT2");
+		case ELF_Def::Constants::ehdr_machine::EM_OPEN8: return os << (_enum_value ? "EM_OPEN8 (196)" : "EM_OPEN8");
+		case ELF_Def::Constants::ehdr_machine::EM_RL78: return os << (_enum_value ? "EM_RL78 (197)" : "EM_RL78");
+		case ELF_Def::Constants::ehdr_machine::EM_VIDEOCORE5: return os << (_enum_value ? "EM_VIDEOCORE5 (198)" : "EM_VIDEOCORE5");
+		case ELF_Def::Constants::ehdr_machine::EM_78KOR: return os << (_enum_value ? "EM_78KOR (199)" : "EM_78KOR");
+		case ELF_Def::Constants::ehdr_machine::EM_56800EX: return os << (_enum_value ? "EM_56800EX (200)" : "EM_56800EX");
+		case ELF_Def::Constants::ehdr_machine::EM_BA1: return os << (_enum_value ? "EM_BA1 (201)" : "EM_BA1");
+		case ELF_Def::Constants::ehdr_machine::EM_BA2: return os << (_enum_value ? "EM_BA2 (202)" : "EM_BA2");
+		case ELF_Def::Constants::ehdr_machine::EM_XCORE: return os << (_enum_value ? "EM_XCORE (203)" : "EM_XCORE");
+		case ELF_Def::Constants::ehdr_machine::EM_MCHP_PIC: return os << (_enum_value ? "EM_MCHP_PIC (204)" : "EM_MCHP_PIC");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL205: return os << (_enum_value ? "EM_INTEL205 (205)" : "EM_INTEL205");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL206: return os << (_enum_value ? "EM_INTEL206 (206)" : "EM_INTEL206");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL207: return os << (_enum_value ? "EM_INTEL207 (207)" : "EM_INTEL207");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL208: return os << (_enum_value ? "EM_INTEL208 (208)" : "EM_INTEL208");
+		case ELF_Def::Constants::ehdr_machine::EM_INTEL209: return os << (_enum_value ? "EM_INTEL209 (209)" : "EM_INTEL209");
+		case ELF_Def::Constants::ehdr_machine::EM_KM32: return os << (_enum_value ? "EM_KM32 (210)" : "EM_KM32");
+		case ELF_Def::Constants::ehdr_machine::EM_KMX32: return os << (_enum_value ? "EM_KMX32 (211)" : "EM_KMX32");
+		case ELF_Def::Constants::ehdr_machine::EM_KMX16: return os << (_enum_value ? "EM_KMX16 (212)" : "EM_KMX16");
+		case ELF_Def::Constants::ehdr_machine::EM_KMX8: return os << (_enum_value ? "EM_KMX8 (213)" : "EM_KMX8");
+		case ELF_Def::Constants::ehdr_machine::EM_KVARC: return os << (_enum_value ? "EM_KVARC (214)" : "EM_KVARC");
+		case ELF_Def::Constants::ehdr_machine::EM_CDP: return os << (_enum_value ? "EM_CDP (215)" : "EM_CDP");
+		case ELF_Def::Constants::ehdr_machine::EM_COGE: return os << (_enum_value ? "EM_COGE (216)" : "EM_COGE");
+		case ELF_Def::Constants::ehdr_machine::EM_COOL: return os << (_enum_value ? "EM_COOL (217)" : "EM_COOL");
+		case ELF_Def::Constants::ehdr_machine::EM_NORC: return os << (_enum_value ? "EM_NORC (218)" : "EM_NORC");
+		case ELF_Def::Constants::ehdr_machine::EM_CSR_KALIMBA: return os << (_enum_value ? "EM_CSR_KALIMBA (219)" : "EM_CSR_KALIMBA");
+		case ELF_Def::Constants::ehdr_machine::EM_Z80: return os << (_enum_value ? "EM_Z80 (220)" : "EM_Z80");
+		case ELF_Def::Constants::ehdr_machine::EM_VISIUM: return os << (_enum_value ? "EM_VISIUM (221)" : "EM_VISIUM");
+		case ELF_Def::Constants::ehdr_machine::EM_FT32: return os << (_enum_value ? "EM_FT32 (222)" : "EM_FT32");
+		case ELF_Def::Constants::ehdr_machine::EM_MOXIE: return os << (_enum_value ? "EM_MOXIE (223)" : "EM_MOXIE");
+		case ELF_Def::Constants::ehdr_machine::EM_AMDGPU: return os << (_enum_value ? "EM_AMDGPU (224)" : "EM_AMDGPU");
+		case ELF_Def::Constants::ehdr_machine::EM_RISCV: return os << (_enum_value ? "EM_RISCV (243)" : "EM_RISCV");
+		case ELF_Def::Constants::ehdr_machine::EM_LANAI: return os << (_enum_value ? "EM_LANAI (244)" : "EM_LANAI");
+		case ELF_Def::Constants::ehdr_machine::EM_CEVA: return os << (_enum_value ? "EM_CEVA (245)" : "EM_CEVA");
+		case ELF_Def::Constants::ehdr_machine::EM_CEVA_X2: return os << (_enum_value ? "EM_CEVA_X2 (246)" : "EM_CEVA_X2");
+		case ELF_Def::Constants::ehdr_machine::EM_BPF: return os << (_enum_value ? "EM_BPF (247)" : "EM_BPF");
+		case ELF_Def::Constants::ehdr_machine::EM_GRAPHCORE_IPU: return os << (_enum_value ? "EM_GRAPHCORE_IPU (248)" : "EM_GRAPHCORE_IPU");
+		case ELF_Def::Constants::ehdr_machine::EM_IMG1: return os << (_enum_value ? "EM_IMG1 (249)" : "EM_IMG1");
+		case ELF_Def::Constants::ehdr_machine::EM_NFP: return os << (_enum_value ? "EM_NFP (250)" : "EM_NFP");
+		case ELF_Def::Constants::ehdr_machine::EM_CSKY: return os << (_enum_value ? "EM_CSKY (252)" : "EM_CSKY");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::ehdr_machine)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::ehdr_machine _enum_values_ehdr_machine[] = {ELF_Def::Constants::ehdr_machine ::EM_386 , ELF_Def::Constants::ehdr_machine ::EM_486 , ELF_Def::Constants::ehdr_machine ::EM_56800EX , ELF_Def::Constants::ehdr_machine ::EM_68HC05 , ELF_Def::Constants::ehdr_machine ::EM_68HC08 , ELF_Def::Constants::ehdr_machine ::EM_68HC11 , ELF_Def::Constants::ehdr_machine ::EM_68HC12 , ELF_Def::Constants::ehdr_machine ::EM_68HC16 , ELF_Def::Constants::ehdr_machine ::EM_68K , ELF_Def::Constants::ehdr_machine ::EM_78KOR , ELF_Def::Constants::ehdr_machine ::EM_8051 , ELF_Def::Constants::ehdr_machine ::EM_860 , ELF_Def::Constants::ehdr_machine ::EM_88K , ELF_Def::Constants::ehdr_machine ::EM_960 , ELF_Def::Constants::ehdr_machine ::EM_ALTERA_NIOS2 , ELF_Def::Constants::ehdr_machine ::EM_AMDGPU , ELF_Def::Constants::ehdr_machine ::EM_ARC , ELF_Def::Constants::ehdr_machine ::EM_ARCA , ELF_Def::Constants::ehdr_machine ::EM_ARC_A5 , ELF_Def::Constants::ehdr_machine ::EM_ARC_COMPACT2 , ELF_Def::Constants::ehdr_machine ::EM_ARM , ELF_Def::Constants::ehdr_machine ::EM_AVR , ELF_Def::Constants::ehdr_machine ::EM_AVR32 , ELF_Def::Constants::ehdr_machine ::EM_BA1 , ELF_Def::Constants::ehdr_machine ::EM_BA2 , ELF_Def::Constants::ehdr_machine ::EM_BLACKFIN , ELF_Def::Constants::ehdr_machine ::EM_BPF , ELF_Def::Constants::ehdr_machine ::EM_C166 , ELF_Def::Constants::ehdr_machine ::EM_CDP , ELF_Def::Constants::ehdr_machine ::EM_CE , ELF_Def::Constants::ehdr_machine ::EM_CEVA , ELF_Def::Constants::ehdr_machine ::EM_CEVA_X2 , ELF_Def::Constants::ehdr_machine ::EM_CLOUDSHIELD , ELF_Def::Constants::ehdr_machine ::EM_COGE , ELF_Def::Constants::ehdr_machine ::EM_COLDFIRE , ELF_Def::Constants::ehdr_machine ::EM_COOL , ELF_Def::Constants::ehdr_machine ::EM_COREA_1ST , ELF_Def::Constants::ehdr_machine ::EM_COREA_2ND , ELF_Def::Constants::ehdr_machine ::EM_CR , ELF_Def::Constants::ehdr_machine ::EM_CR16 , ELF_Def::Constants::ehdr_machine ::EM_CRAYNV2 , ELF_Def::Constants::ehdr_machine ::EM_CRIS , ELF_Def::Constants::ehdr_machine ::EM_CRX , ELF_Def::Constants::ehdr_machine ::EM_CSKY , ELF_Def::Constants::ehdr_machine ::EM_CSR_KALIMBA , ELF_Def::Constants::ehdr_machine ::EM_CUDA , ELF_Def::Constants::ehdr_machine ::EM_CYPRESS_M8C , ELF_Def::Constants::ehdr_machine ::EM_D10V , ELF_Def::Constants::ehdr_machine ::EM_D30V , ELF_Def::Constants::ehdr_machine ::EM_DSP24 , ELF_Def::Constants::ehdr_machine ::EM_DSPIC30F , ELF_Def::Constants::ehdr_machine ::EM_DXP , ELF_Def::Constants::ehdr_machine ::EM_ECOG1 , ELF_Def::Constants::ehdr_machine ::EM_ECOG16 , ELF_Def::Constants::ehdr_machine ::EM_ECOG2 , ELF_Def::Constants::ehdr_machine ::EM_ETPU , ELF_Def::Constants::ehdr_machine ::EM_EXCESS , ELF_Def::Constants::ehdr_machine ::EM_F2MC16 , ELF_Def::Constants::ehdr_machine ::EM_FIREPATH , ELF_Def::Constants::ehdr_machine ::EM_FR20 , ELF_Def::Constants::ehdr_machine ::EM_FR30 , ELF_Def::Constants::ehdr_machine ::EM_FT32 , ELF_Def::Constants::ehdr_machine ::EM_FX66 , ELF_Def::Constants::ehdr_machine ::EM_GRAPHCORE_IPU , ELF_Def::Constants::ehdr_machine ::EM_H8S , ELF_Def::Constants::ehdr_machine ::EM_H8_300 , ELF_Def::Constants::ehdr_machine ::EM_H8_300H , ELF_Def::Constants::ehdr_machine ::EM_H8_500 , ELF_Def::Constants::ehdr_machine ::EM_HUANY , ELF_Def::Constants::ehdr_machine ::EM_IA_64 , ELF_Def::Constants::ehdr_machine ::EM_IMG1 , ELF_Def::Constants::ehdr_machine ::EM_INTEL181 , ELF_Def::Constants::ehdr_machine ::EM_INTEL182 , ELF_Def::Constants::ehdr_machine ::EM_INTEL205 , ELF_Def::Constants::ehdr_machine ::EM_INTEL206 , ELF_Def::Constants::ehdr_machine ::EM_INTEL207 , ELF_Def::Constants::ehdr_machine ::EM_INTEL208 , ELF_Def::Constants::ehdr_machine ::EM_INTEL209 , ELF_Def::Constants::ehdr_machine ::EM_IP2K , ELF_Def::Constants::ehdr_machine ::EM_JAVELIN , ELF_Def::Constants::ehdr_machine ::EM_KM32 , ELF_Def::Constants::ehdr_machine ::EM_KMX16 , ELF_Def::Constants::ehdr_machine ::EM_KMX32 , ELF_Def::Constants::ehdr_machine ::EM_KMX8 , ELF_Def::Constants::ehdr_machine ::EM_KVARC , ELF_Def::Constants::ehdr_machine ::EM_L1OM , ELF_Def::Constants::ehdr_machine ::EM_LANAI , ELF_Def::Constants::ehdr_machine ::EM_LATTICEMICO32 , ELF_Def::Constants::ehdr_machine ::EM_M16C , ELF_Def::Constants::ehdr_machine ::EM_M32 , ELF_Def::Constants::ehdr_machine ::EM_M32C , ELF_Def::Constants::ehdr_machine ::EM_M32R , ELF_Def::Constants::ehdr_machine ::EM_MANIK , ELF_Def::Constants::ehdr_machine ::EM_MAX , ELF_Def::Constants::ehdr_machine ::EM_MAXQ30 , ELF_Def::Constants::ehdr_machine ::EM_MCHP_PIC , ELF_Def::Constants::ehdr_machine ::EM_MCORE , ELF_Def::Constants::ehdr_machine ::EM_MCST_ELBRUS , ELF_Def::Constants::ehdr_machine ::EM_ME16 , ELF_Def::Constants::ehdr_machine ::EM_METAG , ELF_Def::Constants::ehdr_machine ::EM_MICROBLAZE , ELF_Def::Constants::ehdr_machine ::EM_MIPS , ELF_Def::Constants::ehdr_machine ::EM_MIPS_RS3_LE , ELF_Def::Constants::ehdr_machine ::EM_MIPS_X , ELF_Def::Constants::ehdr_machine ::EM_MMA , ELF_Def::Constants::ehdr_machine ::EM_MMDSP_PLUS , ELF_Def::Constants::ehdr_machine ::EM_MMIX , ELF_Def::Constants::ehdr_machine ::EM_MN10200 , ELF_Def::Constants::ehdr_machine ::EM_MN10300 , ELF_Def::Constants::ehdr_machine ::EM_MOXIE , ELF_Def::Constants::ehdr_machine ::EM_MSP430 , ELF_Def::Constants::ehdr_machine ::EM_NCPU , ELF_Def::Constants::ehdr_machine ::EM_NDR1 , ELF_Def::Constants::ehdr_machine ::EM_NDS32 , ELF_Def::Constants::ehdr_machine ::EM_NFP , ELF_Def::Constants::ehdr_machine ::EM_NONE , ELF_Def::Constants::ehdr_machine ::EM_NORC , ELF_Def::Constants::ehdr_machine ::EM_NS32K , ELF_Def::Constants::ehdr_machine ::EM_OLD_ALPHA , ELF_Def::Constants::ehdr_machine ::EM_OPEN8 , ELF_Def::Constants::ehdr_machine ::EM_OPENRISC , ELF_Def::Constants::ehdr_machine ::EM_PARISC , ELF_Def::Constants::ehdr_machine ::EM_PCP , ELF_Def::Constants::ehdr_machine ::EM_PDP10 , ELF_Def::Constants::ehdr_machine ::EM_PDP11 , ELF_Def::Constants::ehdr_machine ::EM_PDSP , ELF_Def::Constants::ehdr_machine ::EM_PJ , ELF_Def::Constants::ehdr_machine ::EM_PPC , ELF_Def::Constants::ehdr_machine ::EM_PPC64 , ELF_Def::Constants::ehdr_machine ::EM_PRISM , ELF_Def::Constants::ehdr_machine ::EM_QDSP6 , ELF_Def::Constants::ehdr_machine ::EM_R32C , ELF_Def::Constants::ehdr_machine ::EM_RH32 , ELF_Def::Constants::ehdr_machine ::EM_RISCV , ELF_Def::Constants::ehdr_machine ::EM_RL78 , ELF_Def::Constants::ehdr_machine ::EM_RS08 , ELF_Def::Constants::ehdr_machine ::EM_RX , ELF_Def::Constants::ehdr_machine ::EM_S370 , ELF_Def::Constants::ehdr_machine ::EM_S390 , ELF_Def::Constants::ehdr_machine ::EM_SCORE , ELF_Def::Constants::ehdr_machine ::EM_SEP , ELF_Def::Constants::ehdr_machine ::EM_SE_C17 , ELF_Def::Constants::ehdr_machine ::EM_SE_C33 , ELF_Def::Constants::ehdr_machine ::EM_SH , ELF_Def::Constants::ehdr_machine ::EM_SLE9X , ELF_Def::Constants::ehdr_machine ::EM_SNP1K , ELF_Def::Constants::ehdr_machine ::EM_SPARC , ELF_Def::Constants::ehdr_machine ::EM_SPARC32PLUS , ELF_Def::Constants::ehdr_machine ::EM_SPARCV9 , ELF_Def::Constants::ehdr_machine ::EM_SPU , ELF_Def::Constants::ehdr_machine ::EM_ST100 , ELF_Def::Constants::ehdr_machine ::EM_ST19 , ELF_Def::Constants::ehdr_machine ::EM_ST200 , ELF_Def::Constants::ehdr_machine ::EM_ST7 , ELF_Def::Constants::ehdr_machine ::EM_ST9PLUS , ELF_Def::Constants::ehdr_machine ::EM_STARCORE , ELF_Def::Constants::ehdr_machine ::EM_STM8 , ELF_Def::Constants::ehdr_machine ::EM_STXP7X , ELF_Def::Constants::ehdr_machine ::EM_SVX , ELF_Def::Constants::ehdr_machine ::EM_TILE64 , ELF_Def::Constants::ehdr_machine ::EM_TILEGX , ELF_Def::Constants::ehdr_machine ::EM_TILEPRO , ELF_Def::Constants::ehdr_machine ::EM_TINYJ , ELF_Def::Constants::ehdr_machine ::EM_TI_C2000 , ELF_Def::Constants::ehdr_machine ::EM_TI_C5500 , ELF_Def::Constants::ehdr_machine ::EM_TI_C6000 , ELF_Def::Constants::ehdr_machine ::EM_TMM_GPP , ELF_Def::Constants::ehdr_machine ::EM_TPC , ELF_Def::Constants::ehdr_machine ::EM_TRICORE , ELF_Def::Constants::ehdr_machine ::EM_TRIMEDIA , ELF_Def::Constants::ehdr_machine ::EM_TSK3000 , ELF_Def::Constants::ehdr_machine ::EM_UNICORE , ELF_Def::Constants::ehdr_machine ::EM_V800 , ELF_Def::Constants::ehdr_machine ::EM_V850 , ELF_Def::Constants::ehdr_machine ::EM_VAX , ELF_Def::Constants::ehdr_machine ::EM_VIDEOCORE , ELF_Def::Constants::ehdr_machine ::EM_VIDEOCORE3 , ELF_Def::Constants::ehdr_machine ::EM_VIDEOCORE5 , ELF_Def::Constants::ehdr_machine ::EM_VISIUM , ELF_Def::Constants::ehdr_machine ::EM_VPP550 , ELF_Def::Constants::ehdr_machine ::EM_X86_64 , ELF_Def::Constants::ehdr_machine ::EM_XCORE , ELF_Def::Constants::ehdr_machine ::EM_XGATE , ELF_Def::Constants::ehdr_machine ::EM_XIMO16 , ELF_Def::Constants::ehdr_machine ::EM_XTENSA , ELF_Def::Constants::ehdr_machine ::EM_Z80 , ELF_Def::Constants::ehdr_machine ::EM_ZSP };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::ehdr_version val) {
+	switch(val) {
+		case ELF_Def::Constants::ehdr_version::EV_NONE: return os << (_enum_value ? "EV_NONE (0)" : "EV_NONE");
+		case ELF_Def::Constants::ehdr_version::EV_CURRENT: return os << (_enum_value ? "EV_CURRENT (1)" : "EV_CURRENT");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::ehdr_version)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::ehdr_version _enum_values_ehdr_version[] = {ELF_Def::Constants::ehdr_version ::EV_CURRENT , ELF_Def::Constants::ehdr_version ::EV_NONE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::shdr_type val) {
+	switch(val) {
+		case ELF_Def::Constants::shdr_type::SHT_NULL: return os << (_enum_value ? "SHT_NULL (0)" : "SHT_NULL");
+		case ELF_Def::Constants::shdr_type::SHT_PROGBITS: return os << (_enum_value ? "SHT_PROGBITS (1)" : "SHT_PROGBITS");
+		case ELF_Def::Constants::shdr_type::SHT_SYMTAB: return os << (_enum_value ? "SHT_SYMTAB (2)" : "SHT_SYMTAB");
+		case ELF_Def::Constants::shdr_type::SHT_STRTAB: return os << (_enum_value ? "SHT_STRTAB (3)" : "SHT_STRTAB");
+		case ELF_Def::Constants::shdr_type::SHT_RELA: return os << (_enum_value ? "SHT_RELA (4)" : "SHT_RELA");
+		case ELF_Def::Constants::shdr_type::SHT_HASH: return os << (_enum_value ? "SHT_HASH (5)" : "SHT_HASH");
+		case ELF_Def::Constants::shdr_type::SHT_DYNAMIC: return os << (_enum_value ? "SHT_DYNAMIC (6)" : "SHT_DYNAMIC");
+		case ELF_Def::Constants::shdr_type::SHT_NOTE: return os << (_enum_value ? "SHT_NOTE (7)" : "SHT_NOTE");
+		case ELF_Def::Constants::shdr_type::SHT_NOBITS: return os << (_enum_value ? "SHT_NOBITS (8)" : "SHT_NOBITS");
+		case ELF_Def::Constants::shdr_type::SHT_REL: return os << (_enum_value ? "SHT_REL (9)" : "SHT_REL");
+		case ELF_Def::Constants::shdr_type::SHT_SHLIB: return os << (_enum_value ? "SHT_SHLIB (10)" : "SHT_SHLIB");
+		case ELF_Def::Constants::shdr_type::SHT_DYNSYM: return os << (_enum_value ? "SHT_DYNSYM (11)" : "SHT_DYNSYM");
+		case ELF_Def::Constants::shdr_type::SHT_INIT_ARRAY: return os << (_enum_value ? "SHT_INIT_ARRAY (14)" : "SHT_INIT_ARRAY");
+		case ELF_Def::Constants::shdr_type::SHT_FINI_ARRAY: return os << (_enum_value ? "SHT_FINI_ARRAY (15)" : "SHT_FINI_ARRAY");
+		case ELF_Def::Constants::shdr_type::SHT_PREINIT_ARRAY: return os << (_enum_value ? "SHT_PREINIT_ARRAY (16)" : "SHT_PREINIT_ARRAY");
+		case ELF_Def::Constants::shdr_type::SHT_GROUP: return os << (_enum_value ? "SHT_GROUP (17)" : "SHT_GROUP");
+		case ELF_Def::Constants::shdr_type::SHT_SYMTAB_SHNDX: return os << (_enum_value ? "SHT_SYMTAB_SHNDX (18)" : "SHT_SYMTAB_SHNDX");
+		case ELF_Def::Constants::shdr_type::SHT_RELR: return os << (_enum_value ? "SHT_RELR (19)" : "SHT_RELR");
+		case ELF_Def::Constants::shdr_type::SHT_NUM: return os << (_enum_value ? "SHT_NUM (20)" : "SHT_NUM");
+		case ELF_Def::Constants::shdr_type::SHT_LOOS: return os << (_enum_value ? "SHT_LOOS (0x60000000)" : "SHT_LOOS");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_ATTRIBUTES: return os << (_enum_value ? "SHT_GNU_ATTRIBUTES (0x6ffffff5)" : "SHT_GNU_ATTRIBUTES");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_HASH: return os << (_enum_value ? "SHT_GNU_HASH (0x6ffffff6)" : "SHT_GNU_HASH");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_LIBLIST: return os << (_enum_value ? "SHT_GNU_LIBLIST (0x6ffffff7)" : "SHT_GNU_LIBLIST");
+		case ELF_Def::Constants::shdr_type::SHT_CHECKSUM: return os << (_enum_value ? "SHT_CHECKSUM (0x6ffffff8)" : "SHT_CHECKSUM");
+		case ELF_Def::Constants::shdr_type::SHT_LOSUNW: return os << (_enum_value ? "SHT_LOSUNW (0x6ffffffa)" : "SHT_LOSUNW");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_VERDEF: return os << (_enum_value ? "SHT_GNU_VERDEF (0x6ffffffd)" : "SHT_GNU_VERDEF");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_VERNEED: return os << (_enum_value ? "SHT_GNU_VERNEED (0x6ffffffe)" : "SHT_GNU_VERNEED");
+		case ELF_Def::Constants::shdr_type::SHT_GNU_VERSYM: return os << (_enum_value ? "SHT_GNU_VERSYM (0x6fffffff)" : "SHT_GNU_VERSYM");
+		case ELF_Def::Constants::shdr_type::SHT_LOPROC: return os << (_enum_value ? "SHT_LOPROC (0x70000000)" : "SHT_LOPROC");
+		case ELF_Def::Constants::shdr_type::SHT_X86_64_UNWIND: return os << (_enum_value ? "SHT_X86_64_UNWIND (0x70000001)" : "SHT_X86_64_UNWIND");
+		case ELF_Def::Constants::shdr_type::SHT_HIPROC: return os << (_enum_value ? "SHT_HIPROC (0x7fffffff)" : "SHT_HIPROC");
+		case ELF_Def::Constants::shdr_type::SHT_LOUSER: return os << (_enum_value ? "SHT_LOUSER (0x80000000)" : "SHT_LOUSER");
+		case ELF_Def::Constants::shdr_type::SHT_HIUSER: return os << (_enum_value ? "SHT_HIUSER (0xffffffff)" : "SHT_HIUSER");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::shdr_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::shdr_type _enum_values_shdr_type[] = {ELF_Def::Constants::shdr_type ::SHT_CHECKSUM , ELF_Def::Constants::shdr_type ::SHT_DYNAMIC , ELF_Def::Constants::shdr_type ::SHT_DYNSYM , ELF_Def::Constants::shdr_type ::SHT_FINI_ARRAY , ELF_Def::Constants::shdr_type ::SHT_GNU_ATTRIBUTES , ELF_Def::Constants::shdr_type ::SHT_GNU_HASH , ELF_Def::Constants::shdr_type ::SHT_GNU_LIBLIST , ELF_Def::Constants::shdr_type ::SHT_GNU_VERDEF , ELF_Def::Constants::shdr_type ::SHT_GNU_VERNEED , ELF_Def::Constants::shdr_type ::SHT_GNU_VERSYM , ELF_Def::Constants::shdr_type ::SHT_GROUP , ELF_Def::Constants::shdr_type ::SHT_HASH , ELF_Def::Constants::shdr_type ::SHT_HIPROC , ELF_Def::Constants::shdr_type ::SHT_HIUSER , ELF_Def::Constants::shdr_type ::SHT_INIT_ARRAY , ELF_Def::Constants::shdr_type ::SHT_LOOS , ELF_Def::Constants::shdr_type ::SHT_LOPROC , ELF_Def::Constants::shdr_type ::SHT_LOSUNW , ELF_Def::Constants::shdr_type ::SHT_LOUSER , ELF_Def::Constants::shdr_type ::SHT_NOBITS , ELF_Def::Constants::shdr_type ::SHT_NOTE , ELF_Def::Constants::shdr_type ::SHT_NULL , ELF_Def::Constants::shdr_type ::SHT_NUM , ELF_Def::Constants::shdr_type ::SHT_PREINIT_ARRAY , ELF_Def::Constants::shdr_type ::SHT_PROGBITS , ELF_Def::Constants::shdr_type ::SHT_REL , ELF_Def::Constants::shdr_type ::SHT_RELA , ELF_Def::Constants::shdr_type ::SHT_RELR , ELF_Def::Constants::shdr_type ::SHT_SHLIB , ELF_Def::Constants::shdr_type ::SHT_STRTAB , ELF_Def::Constants::shdr_type ::SHT_SYMTAB , ELF_Def::Constants::shdr_type ::SHT_SYMTAB_SHNDX , ELF_Def::Constants::shdr_type ::SHT_X86_64_UNWIND };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::chdr_type val) {
+	switch(val) {
+		case ELF_Def::Constants::chdr_type::ELFCOMPRESS_ZLIB: return os << (_enum_value ? "ELFCOMPRESS_ZLIB (1)" : "ELFCOMPRESS_ZLIB");
+		case ELF_Def::Constants::chdr_type::ELFCOMPRESS_LOOS: return os << (_enum_value ? "ELFCOMPRESS_LOOS (0x60000000)" : "ELFCOMPRESS_LOOS");
+		case ELF_Def::Constants::chdr_type::ELFCOMPRESS_HIOS: return os << (_enum_value ? "ELFCOMPRESS_HIOS (0x6fffffff)" : "ELFCOMPRESS_HIOS");
+		case ELF_Def::Constants::chdr_type::ELFCOMPRESS_LOPROC: return os << (_enum_value ? "ELFCOMPRESS_LOPROC (0x70000000)" : "ELFCOMPRESS_LOPROC");
+		case ELF_Def::Constants::chdr_type::ELFCOMPRESS_HIPROC: return os << (_enum_value ? "ELFCOMPRESS_HIPROC (0x7fffffff)" : "ELFCOMPRESS_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::chdr_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::chdr_type _enum_values_chdr_type[] = {ELF_Def::Constants::chdr_type ::ELFCOMPRESS_HIOS , ELF_Def::Constants::chdr_type ::ELFCOMPRESS_HIPROC , ELF_Def::Constants::chdr_type ::ELFCOMPRESS_LOOS , ELF_Def::Constants::chdr_type ::ELFCOMPRESS_LOPROC , ELF_Def::Constants::chdr_type ::ELFCOMPRESS_ZLIB };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::phdr_type val) {
+	switch(val) {
+		case ELF_Def::Constants::phdr_type::PT_NULL: return os << (_enum_value ? "PT_NULL (0)" : "PT_NULL");
+		case ELF_Def::Constants::phdr_type::PT_LOAD: return os << (_enum_value ? "PT_LOAD (1)" : "PT_LOAD");
+		case ELF_Def::Constants::phdr_type::PT_DYNAMIC: return os << (_enum_value ? "PT_DYNAMIC (2)" : "PT_DYNAMIC");
+		case ELF_Def::Constants::phdr_type::PT_INTERP: return os << (_enum_value ? "PT_INTERP (3)" : "PT_INTERP");
+		case ELF_Def::Constants::phdr_type::PT_NOTE: return os << (_enum_value ? "PT_NOTE (4)" : "PT_NOTE");
+		case ELF_Def::Constants::phdr_type::PT_SHLIB: return os << (_enum_value ? "PT_SHLIB (5)" : "PT_SHLIB");
+		case ELF_Def::Constants::phdr_type::PT_PHDR: return os << (_enum_value ? "PT_PHDR (6)" : "PT_PHDR");
+		case ELF_Def::Constants::phdr_type::PT_TLS: return os << (_enum_value ? "PT_TLS (7)" : "PT_TLS");
+		case ELF_Def::Constants::phdr_type::PT_NUM: return os << (_enum_value ? "PT_NUM (8)" : "PT_NUM");
+		case ELF_Def::Constants::phdr_type::PT_LOOS: return os << (_enum_value ? "PT_LOOS (0x60000000)" : "PT_LOOS");
+		case ELF_Def::Constants::phdr_type::PT_GNU_EH_FRAME: return os << (_enum_value ? "PT_GNU_EH_FRAME (0x6474e550)" : "PT_GNU_EH_FRAME");
+		case ELF_Def::Constants::phdr_type::PT_GNU_STACK: return os << (_enum_value ? "PT_GNU_STACK (0x6474e551)" : "PT_GNU_STACK");
+		case ELF_Def::Constants::phdr_type::PT_GNU_RELRO: return os << (_enum_value ? "PT_GNU_RELRO (0x6474e552)" : "PT_GNU_RELRO");
+		case ELF_Def::Constants::phdr_type::PT_GNU_PROPERTY: return os << (_enum_value ? "PT_GNU_PROPERTY (0x6474e553)" : "PT_GNU_PROPERTY");
+		case ELF_Def::Constants::phdr_type::PT_LOSUNW: return os << (_enum_value ? "PT_LOSUNW (0x6ffffffa)" : "PT_LOSUNW");
+		case ELF_Def::Constants::phdr_type::PT_SUNWSTACK: return os << (_enum_value ? "PT_SUNWSTACK (0x6ffffffb)" : "PT_SUNWSTACK");
+		case ELF_Def::Constants::phdr_type::PT_HISUNW: return os << (_enum_value ? "PT_HISUNW (0x6fffffff)" : "PT_HISUNW");
+		case ELF_Def::Constants::phdr_type::PT_LOPROC: return os << (_enum_value ? "PT_LOPROC (0x70000000)" : "PT_LOPROC");
+		case ELF_Def::Constants::phdr_type::PT_HIPROC: return os << (_enum_value ? "PT_HIPROC (0x7fffffff)" : "PT_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::phdr_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::phdr_type _enum_values_phdr_type[] = {ELF_Def::Constants::phdr_type ::PT_DYNAMIC , ELF_Def::Constants::phdr_type ::PT_GNU_EH_FRAME , ELF_Def::Constants::phdr_type ::PT_GNU_PROPERTY , ELF_Def::Constants::phdr_type ::PT_GNU_RELRO , ELF_Def::Constants::phdr_type ::PT_GNU_STACK , ELF_Def::Constants::phdr_type ::PT_HIPROC , ELF_Def::Constants::phdr_type ::PT_HISUNW , ELF_Def::Constants::phdr_type ::PT_INTERP , ELF_Def::Constants::phdr_type ::PT_LOAD , ELF_Def::Constants::phdr_type ::PT_LOOS , ELF_Def::Constants::phdr_type ::PT_LOPROC , ELF_Def::Constants::phdr_type ::PT_LOSUNW , ELF_Def::Constants::phdr_type ::PT_NOTE , ELF_Def::Constants::phdr_type ::PT_NULL , ELF_Def::Constants::phdr_type ::PT_NUM , ELF_Def::Constants::phdr_type ::PT_PHDR , ELF_Def::Constants::phdr_type ::PT_SHLIB , ELF_Def::Constants::phdr_type ::PT_SUNWSTACK , ELF_Def::Constants::phdr_type ::PT_TLS };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::sym_bind val) {
+	switch(val) {
+		case ELF_Def::Constants::sym_bind::STB_LOCAL: return os << (_enum_value ? "STB_LOCAL (0)" : "STB_LOCAL");
+		case ELF_Def::Constants::sym_bind::STB_GLOBAL: return os << (_enum_value ? "STB_GLOBAL (1)" : "STB_GLOBAL");
+		case ELF_Def::Constants::sym_bind::STB_WEAK: return os << (_enum_value ? "STB_WEAK (2)" : "STB_WEAK");
+		case ELF_Def::Constants::sym_bind::STB_LOOS: return os << (_enum_value ? "STB_LOOS (10)" : "STB_LOOS");
+		case ELF_Def::Constants::sym_bind::STB_HIOS: return os << (_enum_value ? "STB_HIOS (12)" : "STB_HIOS");
+		case ELF_Def::Constants::sym_bind::STB_MULTIDEF: return os << (_enum_value ? "STB_MULTIDEF (13)" : "STB_MULTIDEF");
+		case ELF_Def::Constants::sym_bind::STB_HIPROC: return os << (_enum_value ? "STB_HIPROC (15)" : "STB_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::sym_bind)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::sym_bind _enum_values_sym_bind[] = {ELF_Def::Constants::sym_bind ::STB_GLOBAL , ELF_Def::Constants::sym_bind ::STB_HIOS , ELF_Def::Constants::sym_bind ::STB_HIPROC , ELF_Def::Constants::sym_bind ::STB_LOCAL , ELF_Def::Constants::sym_bind ::STB_LOOS , ELF_Def::Constants::sym_bind ::STB_MULTIDEF , ELF_Def::Constants::sym_bind ::STB_WEAK };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::sym_type val) {
+	switch(val) {
+		case ELF_Def::Constants::sym_type::STT_NOTYPE: return os << (_enum_value ? "STT_NOTYPE (0)" : "STT_NOTYPE");
+		case ELF_Def::Constants::sym_type::STT_OBJECT: return os << (_enum_value ? "STT_OBJECT (1)" : "STT_OBJECT");
+		case ELF_Def::Constants::sym_type::STT_FUNC: return os << (_enum_value ? "STT_FUNC (2)" : "STT_FUNC");
+		case ELF_Def::Constants::sym_type::STT_SECTION: return os << (_enum_value ? "STT_SECTION (3)" : "STT_SECTION");
+		case ELF_Def::Constants::sym_type::STT_FILE: return os << (_enum_value ? "STT_FILE (4)" : "STT_FILE");
+		case ELF_Def::Constants::sym_type::STT_COMMON: return os << (_enum_value ? "STT_COMMON (5)" : "STT_COMMON");
+		case ELF_Def::Constants::sym_type::STT_TLS: return os << (_enum_value ? "STT_TLS (6)" : "STT_TLS");
+		case ELF_Def::Constants::sym_type::STT_GNU_IFUNC: return os << (_enum_value ? "STT_GNU_IFUNC (10)" : "STT_GNU_IFUNC");
+		case ELF_Def::Constants::sym_type::STT_HIOS: return os << (_enum_value ? "STT_HIOS (12)" : "STT_HIOS");
+		case ELF_Def::Constants::sym_type::STT_LOPROC: return os << (_enum_value ? "STT_LOPROC (13)" : "STT_LOPROC");
+		case ELF_Def::Constants::sym_type::STT_HIPROC: return os << (_enum_value ? "STT_HIPROC (15)" : "STT_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::sym_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::sym_type _enum_values_sym_type[] = {ELF_Def::Constants::sym_type ::STT_COMMON , ELF_Def::Constants::sym_type ::STT_FILE , ELF_Def::Constants::sym_type ::STT_FUNC , ELF_Def::Constants::sym_type ::STT_GNU_IFUNC , ELF_Def::Constants::sym_type ::STT_HIOS , ELF_Def::Constants::sym_type ::STT_HIPROC , ELF_Def::Constants::sym_type ::STT_LOPROC , ELF_Def::Constants::sym_type ::STT_NOTYPE , ELF_Def::Constants::sym_type ::STT_OBJECT , ELF_Def::Constants::sym_type ::STT_SECTION , ELF_Def::Constants::sym_type ::STT_TLS };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::sym_visibility val) {
+	switch(val) {
+		case ELF_Def::Constants::sym_visibility::STV_DEFAULT: return os << (_enum_value ? "STV_DEFAULT (0)" : "STV_DEFAULT");
+		case ELF_Def::Constants::sym_visibility::STV_INTERNAL: return os << (_enum_value ? "STV_INTERNAL (1)" : "STV_INTERNAL");
+		case ELF_Def::Constants::sym_visibility::STV_HIDDEN: return os << (_enum_value ? "STV_HIDDEN (2)" : "STV_HIDDEN");
+		case ELF_Def::Constants::sym_visibility::STV_PROTECTED: return os << (_enum_value ? "STV_PROTECTED (3)" : "STV_PROTECTED");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::sym_visibility)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::sym_visibility _enum_values_sym_visibility[] = {ELF_Def::Constants::sym_visibility ::STV_DEFAULT , ELF_Def::Constants::sym_visibility ::STV_HIDDEN , ELF_Def::Constants::sym_visibility ::STV_INTERNAL , ELF_Def::Constants::sym_visibility ::STV_PROTECTED };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::sym_shndx_special val) {
+	switch(val) {
+		case ELF_Def::Constants::sym_shndx_special::SHN_UNDEF: return os << (_enum_value ? "SHN_UNDEF (0)" : "SHN_UNDEF");
+		case ELF_Def::Constants::sym_shndx_special::SHN_LORESERVE: return os << (_enum_value ? "SHN_LORESERVE (0xff00)" : "SHN_LORESERVE");
+		case ELF_Def::Constants::sym_shndx_special::SHN_LOOS: return os << (_enum_value ? "SHN_LOOS (0xff20)" : "SHN_LOOS");
+		case ELF_Def::Constants::sym_shndx_special::SHN_HIPROC: return os << (_enum_value ? "SHN_HIPROC (0xff1f)" : "SHN_HIPROC");
+		case ELF_Def::Constants::sym_shndx_special::SHN_HIOS: return os << (_enum_value ? "SHN_HIOS (0xff3f)" : "SHN_HIOS");
+		case ELF_Def::Constants::sym_shndx_special::SHN_ABS: return os << (_enum_value ? "SHN_ABS (0xfff1)" : "SHN_ABS");
+		case ELF_Def::Constants::sym_shndx_special::SHN_COMMON: return os << (_enum_value ? "SHN_COMMON (0xfff2)" : "SHN_COMMON");
+		case ELF_Def::Constants::sym_shndx_special::SHN_XINDEX: return os << (_enum_value ? "SHN_XINDEX (0xffff)" : "SHN_XINDEX");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::sym_shndx_special)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::sym_shndx_special _enum_values_sym_shndx_special[] = {ELF_Def::Constants::sym_shndx_special ::SHN_ABS , ELF_Def::Constants::sym_shndx_special ::SHN_COMMON , ELF_Def::Constants::sym_shndx_special ::SHN_HIOS , ELF_Def::Constants::sym_shndx_special ::SHN_HIPROC , ELF_Def::Constants::sym_shndx_special ::SHN_LOOS , ELF_Def::Constants::sym_shndx_special ::SHN_LORESERVE , ELF_Def::Constants::sym_shndx_special ::SHN_UNDEF , ELF_Def::Constants::sym_shndx_special ::SHN_XINDEX };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::rel_386 val) {
+	switch(val) {
+		case ELF_Def::Constants::rel_386::R_386_NONE: return os << (_enum_value ? "R_386_NONE (0)" : "R_386_NONE");
+		case ELF_Def::Constants::rel_386::R_386_32: return os << (_enum_value ? "R_386_32 (1)" : "R_386_32");
+		case ELF_Def::Constants::rel_386::R_386_PC32: return os << (_enum_value ? "R_386_PC32 (2)" : "R_386_PC32");
+		case ELF_Def::Constants::rel_386::R_386_GOT32: return os << (_enum_value ? "R_386_GOT32 (3)" : "R_386_GOT32");
+		case ELF_Def::Constants::rel_386::R_386_PLT32: return os << (_enum_value ? "R_386_PLT32 (4)" : "R_386_PLT32");
+		case ELF_Def::Constants::rel_386::R_386_COPY: return os << (_enum_value ? "R_386_COPY (5)" : "R_386_COPY");
+		case ELF_Def::Constants::rel_386::R_386_GLOB_DAT: return os << (_enum_value ? "R_386_GLOB_DAT (6)" : "R_386_GLOB_DAT");
+		case ELF_Def::Constants::rel_386::R_386_JMP_SLOT: return os << (_enum_value ? "R_386_JMP_SLOT (7)" : "R_386_JMP_SLOT");
+		case ELF_Def::Constants::rel_386::R_386_RELATIVE: return os << (_enum_value ? "R_386_RELATIVE (8)" : "R_386_RELATIVE");
+		case ELF_Def::Constants::rel_386::R_386_GOTOFF: return os << (_enum_value ? "R_386_GOTOFF (9)" : "R_386_GOTOFF");
+		case ELF_Def::Constants::rel_386::R_386_GOTPC: return os << (_enum_value ? "R_386_GOTPC (10)" : "R_386_GOTPC");
+		case ELF_Def::Constants::rel_386::R_386_32PLT: return os << (_enum_value ? "R_386_32PLT (11)" : "R_386_32PLT");
+		case ELF_Def::Constants::rel_386::R_386_TLS_TPOFF: return os << (_enum_value ? "R_386_TLS_TPOFF (14)" : "R_386_TLS_TPOFF");
+		case ELF_Def::Constants::rel_386::R_386_TLS_IE: return os << (_enum_value ? "R_386_TLS_IE (15)" : "R_386_TLS_IE");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GOTIE: return os << (_enum_value ? "R_386_TLS_GOTIE (16)" : "R_386_TLS_GOTIE");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LE: return os << (_enum_value ? "R_386_TLS_LE (17)" : "R_386_TLS_LE");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GD: return os << (_enum_value ? "R_386_TLS_GD (18)" : "R_386_TLS_GD");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDM: return os << (_enum_value ? "R_386_TLS_LDM (19)" : "R_386_TLS_LDM");
+		case ELF_Def::Constants::rel_386::R_386_16: return os << (_enum_value ? "R_386_16 (20)" : "R_386_16");
+		case ELF_Def::Constants::rel_386::R_386_PC16: return os << (_enum_value ? "R_386_PC16 (21)" : "R_386_PC16");
+		case ELF_Def::Constants::rel_386::R_386_8: return os << (_enum_value ? "R_386_8 (22)" : "R_386_8");
+		case ELF_Def::Constants::rel_386::R_386_PC8: return os << (_enum_value ? "R_386_PC8 (23)" : "R_386_PC8");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GD_32: return os << (_enum_value ? "R_386_TLS_GD_32 (24)" : "R_386_TLS_GD_32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GD_PUSH: return os << (_enum_value ? "R_386_TLS_GD_PUSH (25)" : "R_386_TLS_GD_PUSH");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GD_CALL: return os << (_enum_value ? "R_386_TLS_GD_CALL (26)" : "R_386_TLS_GD_CALL");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GD_POP: return os << (_enum_value ? "R_386_TLS_GD_POP (27)" : "R_386_TLS_GD_POP");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDM_32: return os << (_enum_value ? "R_386_TLS_LDM_32 (28)" : "R_386_TLS_LDM_32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDM_PUSH: return os << (_enum_value ? "R_386_TLS_LDM_PUSH (29)" : "R_386_TLS_LDM_PUSH");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDM_CALL: return os << (_enum_value ? "R_386_TLS_LDM_CALL (30)" : "R_386_TLS_LDM_CALL");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDM_POP: return os << (_enum_value ? "R_386_TLS_LDM_POP (31)" : "R_386_TLS_LDM_POP");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LDO_32: return os << (_enum_value ? "R_386_TLS_LDO_32 (32)" : "R_386_TLS_LDO_32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_IE_32: return os << (_enum_value ? "R_386_TLS_IE_32 (33)" : "R_386_TLS_IE_32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_LE_32: return os << (_enum_value ? "R_386_TLS_LE_32 (34)" : "R_386_TLS_LE_32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_DTPMOD32: return os << (_enum_value ? "R_386_TLS_DTPMOD32 (35)" : "R_386_TLS_DTPMOD32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_DTPOFF32: return os << (_enum_value ? "R_386_TLS_DTPOFF32 (36)" : "R_386_TLS_DTPOFF32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_TPOFF32: return os << (_enum_value ? "R_386_TLS_TPOFF32 (37)" : "R_386_TLS_TPOFF32");
+		case ELF_Def::Constants::rel_386::R_386_SIZE32: return os << (_enum_value ? "R_386_SIZE32 (38)" : "R_386_SIZE32");
+		case ELF_Def::Constants::rel_386::R_386_TLS_GOTDESC: return os << (_enum_value ? "R_386_TLS_GOTDESC (39)" : "R_386_TLS_GOTDESC");
+		case ELF_Def::Constants::rel_386::R_386_TLS_DESC_CALL: return os << (_enum_value ? "R_386_TLS_DESC_CALL (40)" : "R_386_TLS_DESC_CALL");
+		case ELF_Def::Constants::rel_386::R_386_TLS_DESC: return os << (_enum_value ? "R_386_TLS_DESC (41)" : "R_386_TLS_DESC");
+		case ELF_Def::Constants::rel_386::R_386_IRELATIVE: return os << (_enum_value ? "R_386_IRELATIVE (42)" : "R_386_IRELATIVE");
+		case ELF_Def::Constants::rel_386::R_386_GOT32X: return os << (_enum_value ? "R_386_GOT32X (43)" : "R_386_GOT32X");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::rel_386)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::rel_386 _enum_values_rel_386[] = {ELF_Def::Constants::rel_386 ::R_386_16 , ELF_Def::Constants::rel_386 ::R_386_32 , ELF_Def::Constants::rel_386 ::R_386_32PLT , ELF_Def::Constants::rel_386 ::R_386_8 , ELF_Def::Constants::rel_386 ::R_386_COPY , ELF_Def::Constants::rel_386 ::R_386_GLOB_DAT , ELF_Def::Constants::rel_386 ::R_386_GOT32 , ELF_Def::Constants::rel_386 ::R_386_GOT32X , ELF_Def::Constants::rel_386 ::R_386_GOTOFF , ELF_Def::Constants::rel_386 ::R_386_GOTPC , ELF_Def::Constants::rel_386 ::R_386_IRELATIVE , ELF_Def::Constants::rel_386 ::R_386_JMP_SLOT , ELF_Def::Constants::rel_386 ::R_386_NONE , ELF_Def::Constants::rel_386 ::R_386_PC16 , ELF_Def::Constants::rel_386 ::R_386_PC32 , ELF_Def::Constants::rel_386 ::R_386_PC8 , ELF_Def::Constants::rel_386 ::R_386_PLT32 , ELF_Def::Constants::rel_386 ::R_386_RELATIVE , ELF_Def::Constants::rel_386 ::R_386_SIZE32 , ELF_Def::Constants::rel_386 ::R_386_TLS_DESC , ELF_Def::Constants::rel_386 ::R_386_TLS_DESC_CALL , ELF_Def::Constants::rel_386 ::R_386_TLS_DTPMOD32 , ELF_Def::Constants::rel_386 ::R_386_TLS_DTPOFF32 , ELF_Def::Constants::rel_386 ::R_386_TLS_GD , ELF_Def::Constants::rel_386 ::R_386_TLS_GD_32 , ELF_Def::Constants::rel_386 ::R_386_TLS_GD_CALL , ELF_Def::Constants::rel_386 ::R_386_TLS_GD_POP , ELF_Def::Constants::rel_386 ::R_386_TLS_GD_PUSH , ELF_Def::Constants::rel_386 ::R_386_TLS_GOTDESC , ELF_Def::Constants::rel_386 ::R_386_TLS_GOTIE , ELF_Def::Constants::rel_386 ::R_386_TLS_IE , ELF_Def::Constants::rel_386 ::R_386_TLS_IE_32 , ELF_Def::Constants::rel_386 ::R_386_TLS_LDM , ELF_Def::Constants::rel_386 ::R_386_TLS_LDM_32 , ELF_Def::Constants::rel_386 ::R_386_TLS_LDM_CALL , ELF_Def::Constants::rel_386 ::R_386_TLS_LDM_POP , ELF_Def::Constants::rel_386 ::R_386_TLS_LDM_PUSH , ELF_Def::Constants::rel_386 ::R_386_TLS_LDO_32 , ELF_Def::Constants::rel_386 ::R_386_TLS_LE , ELF_Def::Constants::rel_386 ::R_386_TLS_LE_32 , ELF_Def::Constants::rel_386 ::R_386_TLS_TPOFF , ELF_Def::Constants::rel_386 ::R_386_TLS_TPOFF32 };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::rel_x86_64 val) {
+	switch(val) {
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_NONE: return os << (_enum_value ? "R_X86_64_NONE (0)" : "R_X86_64_NONE");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_64: return os << (_enum_value ? "R_X86_64_64 (1)" : "R_X86_64_64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PC32: return os << (_enum_value ? "R_X86_64_PC32 (2)" : "R_X86_64_PC32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOT32: return os << (_enum_value ? "R_X86_64_GOT32 (3)" : "R_X86_64_GOT32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PLT32: return os << (_enum_value ? "R_X86_64_PLT32 (4)" : "R_X86_64_PLT32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_COPY: return os << (_enum_value ? "R_X86_64_COPY (5)" : "R_X86_64_COPY");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GLOB_DAT: return os << (_enum_value ? "R_X86_64_GLOB_DAT (6)" : "R_X86_64_GLOB_DAT");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_JUMP_SLOT: return os << (_enum_value ? "R_X86_64_JUMP_SLOT (7)" : "R_X86_64_JUMP_SLOT");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_RELATIVE: return os << (_enum_value ? "R_X86_64_RELATIVE (8)" : "R_X86_64_RELATIVE");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPCREL: return os << (_enum_value ? "R_X86_64_GOTPCREL (9)" : "R_X86_64_GOTPCREL");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_32: return os << (_enum_value ? "R_X86_64_32 (10)" : "R_X86_64_32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_32S: return os << (_enum_value ? "R_X86_64_32S (11)" : "R_X86_64_32S");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_16: return os << (_enum_value ? "R_X86_64_16 (12)" : "R_X86_64_16");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PC16: return os << (_enum_value ? "R_X86_64_PC16 (13)" : "R_X86_64_PC16");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_8: return os << (_enum_value ? "R_X86_64_8 (14)" : "R_X86_64_8");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PC8: return os << (_enum_value ? "R_X86_64_PC8 (15)" : "R_X86_64_PC8");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_DTPMOD64: return os << (_enum_value ? "R_X86_64_DTPMOD64 (16)" : "R_X86_64_DTPMOD64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_DTPOFF64: return os << (_enum_value ? "R_X86_64_DTPOFF64 (17)" : "R_X86_64_DTPOFF64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TPOFF64: return os << (_enum_value ? "R_X86_64_TPOFF64 (18)" : "R_X86_64_TPOFF64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TLSGD: return os << (_enum_value ? "R_X86_64_TLSGD (19)" : "R_X86_64_TLSGD");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TLSLD: return os << (_enum_value ? "R_X86_64_TLSLD (20)" : "R_X86_64_TLSLD");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_DTPOFF32: return os << (_enum_value ? "R_X86_64_DTPOFF32 (21)" : "R_X86_64_DTPOFF32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTTPOFF: return os << (_enum_value ? "R_X86_64_GOTTPOFF (22)" : "R_X86_64_GOTTPOFF");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TPOFF32: return os << (_enum_value ? "R_X86_64_TPOFF32 (23)" : "R_X86_64_TPOFF32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PC64: return os << (_enum_value ? "R_X86_64_PC64 (24)" : "R_X86_64_PC64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTOFF64: return os << (_enum_value ? "R_X86_64_GOTOFF64 (25)" : "R_X86_64_GOTOFF64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPC32: return os << (_enum_value ? "R_X86_64_GOTPC32 (26)" : "R_X86_64_GOTPC32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOT64: return os << (_enum_value ? "R_X86_64_GOT64 (27)" : "R_X86_64_GOT64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPCREL64: return os << (_enum_value ? "R_X86_64_GOTPCREL64 (28)" : "R_X86_64_GOTPCREL64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPC64: return os << (_enum_value ? "R_X86_64_GOTPC64 (29)" : "R_X86_64_GOTPC64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPLT64: return os << (_enum_value ? "R_X86_64_GOTPLT64 (30)" : "R_X86_64_GOTPLT64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_PLTOFF64: return os << (_enum_value ? "R_X86_64_PLTOFF64 (31)" : "R_X86_64_PLTOFF64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_SIZE32: return os << (_enum_value ? "R_X86_64_SIZE32 (32)" : "R_X86_64_SIZE32");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_SIZE64: return os << (_enum_value ? "R_X86_64_SIZE64 (33)" : "R_X86_64_SIZE64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPC32_TLSDESC: return os << (_enum_value ? "R_X86_64_GOTPC32_TLSDESC (34)" : "R_X86_64_GOTPC32_TLSDESC");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TLSDESC_CALL: return os << (_enum_value ? "R_X86_64_TLSDESC_CALL (35)" : "R_X86_64_TLSDESC_CALL");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_TLSDESC: return os << (_enum_value ? "R_X86_64_TLSDESC (36)" : "R_X86_64_TLSDESC");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_IRELATIVE: return os << (_enum_value ? "R_X86_64_IRELATIVE (37)" : "R_X86_64_IRELATIVE");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_RELATIVE64: return os << (_enum_value ? "R_X86_64_RELATIVE64 (38)" : "R_X86_64_RELATIVE64");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GOTPCRELX: return os << (_enum_value ? "R_X86_64_GOTPCRELX (41)" : "R_X86_64_GOTPCRELX");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_REX_GOTPCRELX: return os << (_enum_value ? "R_X86_64_REX_GOTPCRELX (42)" : "R_X86_64_REX_GOTPCRELX");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GNU_VTINHERIT: return os << (_enum_value ? "R_X86_64_GNU_VTINHERIT (250)" : "R_X86_64_GNU_VTINHERIT");
+		case ELF_Def::Constants::rel_x86_64::R_X86_64_GNU_VTENTRY: return os << (_enum_value ? "R_X86_64_GNU_VTENTRY (251)" : "R_X86_64_GNU_VTENTRY");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::rel_x86_64)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::rel_x86_64 _enum_values_rel_x86_64[] = {ELF_Def::Constants::rel_x86_64 ::R_X86_64_16 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_32S , ELF_Def::Constants::rel_x86_64 ::R_X86_64_64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_8 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_COPY , ELF_Def::Constants::rel_x86_64 ::R_X86_64_DTPMOD64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_DTPOFF32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_DTPOFF64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GLOB_DAT , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GNU_VTENTRY , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GNU_VTINHERIT , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOT32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOT64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTOFF64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPC32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPC32_TLSDESC , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPC64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPCREL , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPCREL64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPCRELX , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTPLT64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_GOTTPOFF , ELF_Def::Constants::rel_x86_64 ::R_X86_64_IRELATIVE , ELF_Def::Constants::rel_x86_64 ::R_X86_64_JUMP_SLOT , ELF_Def::Constants::rel_x86_64 ::R_X86_64_NONE , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PC16 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PC32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PC64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PC8 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PLT32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_PLTOFF64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_RELATIVE , ELF_Def::Constants::rel_x86_64 ::R_X86_64_RELATIVE64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_REX_GOTPCRELX , ELF_Def::Constants::rel_x86_64 ::R_X86_64_SIZE32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_SIZE64 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TLSDESC , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TLSDESC_CALL , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TLSGD , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TLSLD , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TPOFF32 , ELF_Def::Constants::rel_x86_64 ::R_X86_64_TPOFF64 };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::dyn_tag val) {
+	switch(val) {
+		case ELF_Def::Constants::dyn_tag::DT_NULL: return os << (_enum_value ? "DT_NULL (0)" : "DT_NULL");
+		case ELF_Def::Constants::dyn_tag::DT_NEEDED: return os << (_enum_value ? "DT_NEEDED (1)" : "DT_NEEDED");
+		case ELF_Def::Constants::dyn_tag::DT_PLTRELSZ: return os << (_enum_value ? "DT_PLTRELSZ (2)" : "DT_PLTRELSZ");
+		case ELF_Def::Constants::dyn_tag::DT_PLTGOT: return os << (_enum_value ? "DT_PLTGOT (3)" : "DT_PLTGOT");
+		case ELF_Def::Constants::dyn_tag::DT_HASH: return os << (_enum_value ? "DT_HASH (4)" : "DT_HASH");
+		case ELF_Def::Constants::dyn_tag::DT_STRTAB: return os << (_enum_value ? "DT_STRTAB (5)" : "DT_STRTAB");
+		case ELF_Def::Constants::dyn_tag::DT_SYMTAB: return os << (_enum_value ? "DT_SYMTAB (6)" : "DT_SYMTAB");
+		case ELF_Def::Constants::dyn_tag::DT_RELA: return os << (_enum_value ? "DT_RELA (7)" : "DT_RELA");
+		case ELF_Def::Constants::dyn_tag::DT_RELASZ: return os << (_enum_value ? "DT_RELASZ (8)" : "DT_RELASZ");
+		case ELF_Def::Constants::dyn_tag::DT_RELAENT: return os << (_enum_value ? "DT_RELAENT (9)" : "DT_RELAENT");
+		case ELF_Def::Constants::dyn_tag::DT_STRSZ: return os << (_enum_value ? "DT_STRSZ (10)" : "DT_STRSZ");
+		case ELF_Def::Constants::dyn_tag::DT_SYMENT: return os << (_enum_value ? "DT_SYMENT (11)" : "DT_SYMENT");
+		case ELF_Def::Constants::dyn_tag::DT_INIT: return os << (_enum_value ? "DT_INIT (12)" : "DT_INIT");
+		case ELF_Def::Constants::dyn_tag::DT_FINI: return os << (_enum_value ? "DT_FINI (13)" : "DT_FINI");
+		case ELF_Def::Constants::dyn_tag::DT_SONAME: return os << (_enum_value ? "DT_SONAME (14)" : "DT_SONAME");
+		case ELF_Def::Constants::dyn_tag::DT_RPATH: return os << (_enum_value ? "DT_RPATH (15)" : "DT_RPATH");
+		case ELF_Def::Constants::dyn_tag::DT_SYMBOLIC: return os << (_enum_value ? "DT_SYMBOLIC (16)" : "DT_SYMBOLIC");
+		case ELF_Def::Constants::dyn_tag::DT_REL: return os << (_enum_value ? "DT_REL (17)" : "DT_REL");
+		case ELF_Def::Constants::dyn_tag::DT_RELSZ: return os << (_enum_value ? "DT_RELSZ (18)" : "DT_RELSZ");
+		case ELF_Def::Constants::dyn_tag::DT_RELENT: return os << (_enum_value ? "DT_RELENT (19)" : "DT_RELENT");
+		case ELF_Def::Constants::dyn_tag::DT_PLTREL: return os << (_enum_value ? "DT_PLTREL (20)" : "DT_PLTREL");
+		case ELF_Def::Constants::dyn_tag::DT_DEBUG: return os << (_enum_value ? "DT_DEBUG (21)" : "DT_DEBUG");
+		case ELF_Def::Constants::dyn_tag::DT_TEXTREL: return os << (_enum_value ? "DT_TEXTREL (22)" : "DT_TEXTREL");
+		case ELF_Def::Constants::dyn_tag::DT_JMPREL: return os << (_enum_value ? "DT_JMPREL (23)" : "DT_JMPREL");
+		case ELF_Def::Constants::dyn_tag::DT_BIND_NOW: return os << (_enum_value ? "DT_BIND_NOW (24)" : "DT_BIND_NOW");
+		case ELF_Def::Constants::dyn_tag::DT_INIT_ARRAY: return os << (_enum_value ? "DT_INIT_ARRAY (25)" : "DT_INIT_ARRAY");
+		case ELF_Def::Constants::dyn_tag::DT_FINI_ARRAY: return os << (_enum_value ? "DT_FINI_ARRAY (26)" : "DT_FINI_ARRAY");
+		case ELF_Def::Constants::dyn_tag::DT_INIT_ARRAYSZ: return os << (_enum_value ? "DT_INIT_ARRAYSZ (27)" : "DT_INIT_ARRAYSZ");
+		case ELF_Def::Constants::dyn_tag::DT_FINI_ARRAYSZ: return os << (_enum_value ? "DT_FINI_ARRAYSZ (28)" : "DT_FINI_ARRAYSZ");
+		case ELF_Def::Constants::dyn_tag::DT_RUNPATH: return os << (_enum_value ? "DT_RUNPATH (29)" : "DT_RUNPATH");
+		case ELF_Def::Constants::dyn_tag::DT_FLAGS: return os << (_enum_value ? "DT_FLAGS (30)" : "DT_FLAGS");
+		case ELF_Def::Constants::dyn_tag::DT_PREINIT_ARRAY: return os << (_enum_value ? "DT_PREINIT_ARRAY (32)" : "DT_PREINIT_ARRAY");
+		case ELF_Def::Constants::dyn_tag::DT_PREINIT_ARRAYSZ: return os << (_enum_value ? "DT_PREINIT_ARRAYSZ (33)" : "DT_PREINIT_ARRAYSZ");
+		case ELF_Def::Constants::dyn_tag::DT_SYMTAB_SHNDX: return os << (_enum_value ? "DT_SYMTAB_SHNDX (34)" : "DT_SYMTAB_SHNDX");
+		case ELF_Def::Constants::dyn_tag::DT_RELRSZ: return os << (_enum_value ? "DT_RELRSZ (35)" : "DT_RELRSZ");
+		case ELF_Def::Constants::dyn_tag::DT_RELR: return os << (_enum_value ? "DT_RELR (36)" : "DT_RELR");
+		case ELF_Def::Constants::dyn_tag::DT_RELRENT: return os << (_enum_value ? "DT_RELRENT (37)" : "DT_RELRENT");
+		case ELF_Def::Constants::dyn_tag::DT_NUM: return os << (_enum_value ? "DT_NUM (38)" : "DT_NUM");
+		case ELF_Def::Constants::dyn_tag::DT_LOOS: return os << (_enum_value ? "DT_LOOS (0x6000000d)" : "DT_LOOS");
+		case ELF_Def::Constants::dyn_tag::DT_HIOS: return os << (_enum_value ? "DT_HIOS (0x6ffff000)" : "DT_HIOS");
+		case ELF_Def::Constants::dyn_tag::DT_VALRNGLO: return os << (_enum_value ? "DT_VALRNGLO (0x6ffffd00)" : "DT_VALRNGLO");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_PRELINKED: return os << (_enum_value ? "DT_GNU_PRELINKED (0x6ffffdf5)" : "DT_GNU_PRELINKED");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_CONFLICTSZ: return os << (_enum_value ? "DT_GNU_CONFLICTSZ (0x6ffffdf6)" : "DT_GNU_CONFLICTSZ");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_LIBLISTSZ: return os << (_enum_value ? "DT_GNU_LIBLISTSZ (0x6ffffdf7)" : "DT_GNU_LIBLISTSZ");
+		case ELF_Def::Constants::dyn_tag::DT_CHECKSUM: return os << (_enum_value ? "DT_CHECKSUM (0x6ffffdf8)" : "DT_CHECKSUM");
+		case ELF_Def::Constants::dyn_tag::DT_PLTPADSZ: return os << (_enum_value ? "DT_PLTPADSZ (0x6ffffdf9)" : "DT_PLTPADSZ");
+		case ELF_Def::Constants::dyn_tag::DT_MOVEENT: return os << (_enum_value ? "DT_MOVEENT (0x6ffffdfa)" : "DT_MOVEENT");
+		case ELF_Def::Constants::dyn_tag::DT_MOVESZ: return os << (_enum_value ? "DT_MOVESZ (0x6ffffdfb)" : "DT_MOVESZ");
+		case ELF_Def::Constants::dyn_tag::DT_FEATURE_1: return os << (_enum_value ? "DT_FEATURE_1 (0x6ffffdfc)" : "DT_FEATURE_1");
+		case ELF_Def::Constants::dyn_tag::DT_POSFLAG_1: return os << (_enum_value ? "DT_POSFLAG_1 (0x6ffffdfd)" : "DT_POSFLAG_1");
+		case ELF_Def::Constants::dyn_tag::DT_SYMINSZ: return os << (_enum_value ? "DT_SYMINSZ (0x6ffffdfe)" : "DT_SYMINSZ");
+		case ELF_Def::Constants::dyn_tag::DT_SYMINENT: return os << (_enum_value ? "DT_SYMINENT (0x6ffffdff)" : "DT_SYMINENT");
+		case ELF_Def::Constants::dyn_tag::DT_ADDRRNGLO: return os << (_enum_value ? "DT_ADDRRNGLO (0x6ffffe00)" : "DT_ADDRRNGLO");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_HASH: return os << (_enum_value ? "DT_GNU_HASH (0x6ffffef5)" : "DT_GNU_HASH");
+		case ELF_Def::Constants::dyn_tag::DT_TLSDESC_PLT: return os << (_enum_value ? "DT_TLSDESC_PLT (0x6ffffef6)" : "DT_TLSDESC_PLT");
+		case ELF_Def::Constants::dyn_tag::DT_TLSDESC_GOT: return os << (_enum_value ? "DT_TLSDESC_GOT (0x6ffffef7)" : "DT_TLSDESC_GOT");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_CONFLICT: return os << (_enum_value ? "DT_GNU_CONFLICT (0x6ffffef8)" : "DT_GNU_CONFLICT");
+		case ELF_Def::Constants::dyn_tag::DT_GNU_LIBLIST: return os << (_enum_value ? "DT_GNU_LIBLIST (0x6ffffef9)" : "DT_GNU_LIBLIST");
+		case ELF_Def::Constants::dyn_tag::DT_CONFIG: return os << (_enum_value ? "DT_CONFIG (0x6ffffefa)" : "DT_CONFIG");
+		case ELF_Def::Constants::dyn_tag::DT_DEPAUDIT: return os << (_enum_value ? "DT_DEPAUDIT (0x6ffffefb)" : "DT_DEPAUDIT");
+		case ELF_Def::Constants::dyn_tag::DT_AUDIT: return os << (_enum_value ? "DT_AUDIT (0x6ffffefc)" : "DT_AUDIT");
+		case ELF_Def::Constants::dyn_tag::DT_PLTPAD: return os << (_enum_value ? "DT_PLTPAD (0x6ffffefd)" : "DT_PLTPAD");
+		case ELF_Def::Constants::dyn_tag::DT_MOVETAB: return os << (_enum_value ? "DT_MOVETAB (0x6ffffefe)" : "DT_MOVETAB");
+		case ELF_Def::Constants::dyn_tag::DT_SYMINFO: return os << (_enum_value ? "DT_SYMINFO (0x6ffffeff)" : "DT_SYMINFO");
+		case ELF_Def::Constants::dyn_tag::DT_VERSYM: return os << (_enum_value ? "DT_VERSYM (0x6ffffff0)" : "DT_VERSYM");
+		case ELF_Def::Constants::dyn_tag::DT_RELACOUNT: return os << (_enum_value ? "DT_RELACOUNT (0x6ffffff9)" : "DT_RELACOUNT");
+		case ELF_Def::Constants::dyn_tag::DT_RELCOUNT: return os << (_enum_value ? "DT_RELCOUNT (0x6ffffffa)" : "DT_RELCOUNT");
+		case ELF_Def::Constants::dyn_tag::DT_FLAGS_1: return os << (_enum_value ? "DT_FLAGS_1 (0x6ffffffb)" : "DT_FLAGS_1");
+		case ELF_Def::Constants::dyn_tag::DT_VERDEF: return os << (_enum_value ? "DT_VERDEF (0x6ffffffc)" : "DT_VERDEF");
+		case ELF_Def::Constants::dyn_tag::DT_VERDEFNUM: return os << (_enum_value ? "DT_VERDEFNUM (0x6ffffffd)" : "DT_VERDEFNUM");
+		case ELF_Def::Constants::dyn_tag::DT_VERNEED: return os << (_enum_value ? "DT_VERNEED (0x6ffffffe)" : "DT_VERNEED");
+		case ELF_Def::Constants::dyn_tag::DT_VERNEEDNUM: return os << (_enum_value ? "DT_VERNEEDNUM (0x6fffffff)" : "DT_VERNEEDNUM");
+		case ELF_Def::Constants::dyn_tag::DT_LOPROC: return os << (_enum_value ? "DT_LOPROC (0x70000000)" : "DT_LOPROC");
+		case ELF_Def::Constants::dyn_tag::DT_AUXILIARY: return os << (_enum_value ? "DT_AUXILIARY (0x7ffffffd)" : "DT_AUXILIARY");
+		case ELF_Def::Constants::dyn_tag::DT_HIPROC: return os << (_enum_value ? "DT_HIPROC (0x7fffffff)" : "DT_HIPROC");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::dyn_tag)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::dyn_tag _enum_values_dyn_tag[] = {ELF_Def::Constants::dyn_tag ::DT_ADDRRNGLO , ELF_Def::Constants::dyn_tag ::DT_AUDIT , ELF_Def::Constants::dyn_tag ::DT_AUXILIARY , ELF_Def::Constants::dyn_tag ::DT_BIND_NOW , ELF_Def::Constants::dyn_tag ::DT_CHECKSUM , ELF_Def::Constants::dyn_tag ::DT_CONFIG , ELF_Def::Constants::dyn_tag ::DT_DEBUG , ELF_Def::Constants::dyn_tag ::DT_DEPAUDIT , ELF_Def::Constants::dyn_tag ::DT_FEATURE_1 , ELF_Def::Constants::dyn_tag ::DT_FINI , ELF_Def::Constants::dyn_tag ::DT_FINI_ARRAY , ELF_Def::Constants::dyn_tag ::DT_FINI_ARRAYSZ , ELF_Def::Constants::dyn_tag ::DT_FLAGS , ELF_Def::Constants::dyn_tag ::DT_FLAGS_1 , ELF_Def::Constants::dyn_tag ::DT_GNU_CONFLICT , ELF_Def::Constants::dyn_tag ::DT_GNU_CONFLICTSZ , ELF_Def::Constants::dyn_tag ::DT_GNU_HASH , ELF_Def::Constants::dyn_tag ::DT_GNU_LIBLIST , ELF_Def::Constants::dyn_tag ::DT_GNU_LIBLISTSZ , ELF_Def::Constants::dyn_tag ::DT_GNU_PRELINKED , ELF_Def::Constants::dyn_tag ::DT_HASH , ELF_Def::Constants::dyn_tag ::DT_HIOS , ELF_Def::Constants::dyn_tag ::DT_HIPROC , ELF_Def::Constants::dyn_tag ::DT_INIT , ELF_Def::Constants::dyn_tag ::DT_INIT_ARRAY , ELF_Def::Constants::dyn_tag ::DT_INIT_ARRAYSZ , ELF_Def::Constants::dyn_tag ::DT_JMPREL , ELF_Def::Constants::dyn_tag ::DT_LOOS , ELF_Def::Constants::dyn_tag ::DT_LOPROC , ELF_Def::Constants::dyn_tag ::DT_MOVEENT , ELF_Def::Constants::dyn_tag ::DT_MOVESZ , ELF_Def::Constants::dyn_tag ::DT_MOVETAB , ELF_Def::Constants::dyn_tag ::DT_NEEDED , ELF_Def::Constants::dyn_tag ::DT_NULL , ELF_Def::Constants::dyn_tag ::DT_NUM , ELF_Def::Constants::dyn_tag ::DT_PLTGOT , ELF_Def::Constants::dyn_tag ::DT_PLTPAD , ELF_Def::Constants::dyn_tag ::DT_PLTPADSZ , ELF_Def::Constants::dyn_tag ::DT_PLTREL , ELF_Def::Constants::dyn_tag ::DT_PLTRELSZ , ELF_Def::Constants::dyn_tag ::DT_POSFLAG_1 , ELF_Def::Constants::dyn_tag ::DT_PREINIT_ARRAY , ELF_Def::Constants::dyn_tag ::DT_PREINIT_ARRAYSZ , ELF_Def::Constants::dyn_tag ::DT_REL , ELF_Def::Constants::dyn_tag ::DT_RELA , ELF_Def::Constants::dyn_tag ::DT_RELACOUNT , ELF_Def::Constants::dyn_tag ::DT_RELAENT , ELF_Def::Constants::dyn_tag ::DT_RELASZ , ELF_Def::Constants::dyn_tag ::DT_RELCOUNT , ELF_Def::Constants::dyn_tag ::DT_RELENT , ELF_Def::Constants::dyn_tag ::DT_RELR , ELF_Def::Constants::dyn_tag ::DT_RELRENT , ELF_Def::Constants::dyn_tag ::DT_RELRSZ , ELF_Def::Constants::dyn_tag ::DT_RELSZ , ELF_Def::Constants::dyn_tag ::DT_RPATH , ELF_Def::Constants::dyn_tag ::DT_RUNPATH , ELF_Def::Constants::dyn_tag ::DT_SONAME , ELF_Def::Constants::dyn_tag ::DT_STRSZ , ELF_Def::Constants::dyn_tag ::DT_STRTAB , ELF_Def::Constants::dyn_tag ::DT_SYMBOLIC , ELF_Def::Constants::dyn_tag ::DT_SYMENT , ELF_Def::Constants::dyn_tag ::DT_SYMINENT , ELF_Def::Constants::dyn_tag ::DT_SYMINFO , ELF_Def::Constants::dyn_tag ::DT_SYMINSZ , ELF_Def::Constants::dyn_tag ::DT_SYMTAB , ELF_Def::Constants::dyn_tag ::DT_SYMTAB_SHNDX , ELF_Def::Constants::dyn_tag ::DT_TEXTREL , ELF_Def::Constants::dyn_tag ::DT_TLSDESC_GOT , ELF_Def::Constants::dyn_tag ::DT_TLSDESC_PLT , ELF_Def::Constants::dyn_tag ::DT_VALRNGLO , ELF_Def::Constants::dyn_tag ::DT_VERDEF , ELF_Def::Constants::dyn_tag ::DT_VERDEFNUM , ELF_Def::Constants::dyn_tag ::DT_VERNEED , ELF_Def::Constants::dyn_tag ::DT_VERNEEDNUM , ELF_Def::Constants::dyn_tag ::DT_VERSYM };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::dyn_val_flags val) {
+	switch(val) {
+		case ELF_Def::Constants::dyn_val_flags::DF_ORIGIN: return os << (_enum_value ? "DF_ORIGIN (1)" : "DF_ORIGIN");
+		case ELF_Def::Constants::dyn_val_flags::DF_SYMBOLIC: return os << (_enum_value ? "DF_SYMBOLIC (2)" : "DF_SYMBOLIC");
+		case ELF_Def::Constants::dyn_val_flags::DF_TEXTREL: return os << (_enum_value ? "DF_TEXTREL (4)" : "DF_TEXTREL");
+		case ELF_Def::Constants::dyn_val_flags::DF_BIND_NOW: return os << (_enum_value ? "DF_BIND_NOW (8)" : "DF_BIND_NOW");
+		case ELF_Def::Constants::dyn_val_flags::DF_STATIC_TLS: return os << (_enum_value ? "DF_STATIC_TLS (16)" : "DF_STATIC_TLS");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::dyn_val_flags)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::dyn_val_flags _enum_values_dyn_val_flags[] = {ELF_Def::Constants::dyn_val_flags ::DF_BIND_NOW , ELF_Def::Constants::dyn_val_flags ::DF_ORIGIN , ELF_Def::Constants::dyn_val_flags ::DF_STATIC_TLS , ELF_Def::Constants::dyn_val_flags ::DF_SYMBOLIC , ELF_Def::Constants::dyn_val_flags ::DF_TEXTREL };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::dyn_val_flags_1 val) {
+	switch(val) {
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NOW: return os << (_enum_value ? "DF_1_NOW (1)" : "DF_1_NOW");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_GLOBAL: return os << (_enum_value ? "DF_1_GLOBAL (2)" : "DF_1_GLOBAL");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_GROUP: return os << (_enum_value ? "DF_1_GROUP (4)" : "DF_1_GROUP");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NODELETE: return os << (_enum_value ? "DF_1_NODELETE (8)" : "DF_1_NODELETE");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_LOADFLTR: return os << (_enum_value ? "DF_1_LOADFLTR (16)" : "DF_1_LOADFLTR");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_INITFIRST: return os << (_enum_value ? "DF_1_INITFIRST (32)" : "DF_1_INITFIRST");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NOOPEN: return os << (_enum_value ? "DF_1_NOOPEN (64)" : "DF_1_NOOPEN");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_ORIGIN: return os << (_enum_value ? "DF_1_ORIGIN (128)" : "DF_1_ORIGIN");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_DIRECT: return os << (_enum_value ? "DF_1_DIRECT (0x100)" : "DF_1_DIRECT");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_TRANS: return os << (_enum_value ? "DF_1_TRANS (0x200)" : "DF_1_TRANS");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_INTERPOSE: return os << (_enum_value ? "DF_1_INTERPOSE (0x400)" : "DF_1_INTERPOSE");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NODEFLIB: return os << (_enum_value ? "DF_1_NODEFLIB (0x800)" : "DF_1_NODEFLIB");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NODUMP: return os << (_enum_value ? "DF_1_NODUMP (0x1000)" : "DF_1_NODUMP");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_CONFALT: return os << (_enum_value ? "DF_1_CONFALT (0x2000)" : "DF_1_CONFALT");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_ENDFILTEE: return os << (_enum_value ? "DF_1_ENDFILTEE (0x4000)" : "DF_1_ENDFILTEE");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_DISPRELDNE: return os << (_enum_value ? "DF_1_DISPRELDNE (0x8000)" : "DF_1_DISPRELDNE");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_DISPRELPND: return os << (_enum_value ? "DF_1_DISPRELPND (0x10000)" : "DF_1_DISPRELPND");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NODIRECT: return os << (_enum_value ? "DF_1_NODIRECT (0x20000)" : "DF_1_NODIRECT");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_IGNMULDEF: return os << (_enum_value ? "DF_1_IGNMULDEF (0x40000)" : "DF_1_IGNMULDEF");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NOKSYMS: return os << (_enum_value ? "DF_1_NOKSYMS (0x80000)" : "DF_1_NOKSYMS");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NOHDR: return os << (_enum_value ? "DF_1_NOHDR (0x100000)" : "DF_1_NOHDR");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_EDITED: return os << (_enum_value ? "DF_1_EDITED (0x200000)" : "DF_1_EDITED");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_NORELOC: return os << (_enum_value ? "DF_1_NORELOC (0x400000)" : "DF_1_NORELOC");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_SYMINTPOSE: return os << (_enum_value ? "DF_1_SYMINTPOSE (0x800000)" : "DF_1_SYMINTPOSE");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_GLOBAUDIT: return os << (_enum_value ? "DF_1_GLOBAUDIT (0x1000000)" : "DF_1_GLOBAUDIT");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_SINGLETON: return os << (_enum_value ? "DF_1_SINGLETON (0x2000000)" : "DF_1_SINGLETON");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_STUB: return os << (_enum_value ? "DF_1_STUB (0x4000000)" : "DF_1_STUB");
+		case ELF_Def::Constants::dyn_val_flags_1::DF_1_PIE: return os << (_enum_value ? "DF_1_PIE (0x8000000)" : "DF_1_PIE");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::dyn_val_flags_1)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::dyn_val_flags_1 _enum_values_dyn_val_flags_1[] = {ELF_Def::Constants::dyn_val_flags_1 ::DF_1_CONFALT , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_DIRECT , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_DISPRELDNE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_DISPRELPND , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_EDITED , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_ENDFILTEE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_GLOBAL , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_GLOBAUDIT , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_GROUP , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_IGNMULDEF , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_INITFIRST , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_INTERPOSE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_LOADFLTR , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NODEFLIB , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NODELETE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NODIRECT , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NODUMP , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NOHDR , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NOKSYMS , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NOOPEN , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NORELOC , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_NOW , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_ORIGIN , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_PIE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_SINGLETON , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_STUB , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_SYMINTPOSE , ELF_Def::Constants::dyn_val_flags_1 ::DF_1_TRANS };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::dyn_val_feature_1 val) {
+	switch(val) {
+		case ELF_Def::Constants::dyn_val_feature_1::DTF_1_PARINIT: return os << (_enum_value ? "DTF_1_PARINIT (1)" : "DTF_1_PARINIT");
+		case ELF_Def::Constants::dyn_val_feature_1::DTF_1_CONFEXP: return os << (_enum_value ? "DTF_1_CONFEXP (2)" : "DTF_1_CONFEXP");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::dyn_val_feature_1)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::dyn_val_feature_1 _enum_values_dyn_val_feature_1[] = {ELF_Def::Constants::dyn_val_feature_1 ::DTF_1_CONFEXP , ELF_Def::Constants::dyn_val_feature_1 ::DTF_1_PARINIT };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::nhdr_type val) {
+	switch(val) {
+		case ELF_Def::Constants::nhdr_type::NT_VERSION: return os << (_enum_value ? "NT_VERSION (1)" : "NT_VERSION");
+		case ELF_Def::Constants::nhdr_type::NT_ARCH: return os << (_enum_value ? "NT_ARCH (2)" : "NT_ARCH");
+		case ELF_Def::Constants::nhdr_type::NT_PRPSINFO: return os << (_enum_value ? "NT_PRPSINFO (3)" : "NT_PRPSINFO");
+		case ELF_Def::Constants::nhdr_type::NT_PRXREG: return os << (_enum_value ? "NT_PRXREG (4)" : "NT_PRXREG");
+		case ELF_Def::Constants::nhdr_type::NT_PLATFORM: return os << (_enum_value ? "NT_PLATFORM (5)" : "NT_PLATFORM");
+		case ELF_Def::Constants::nhdr_type::NT_AUXV: return os << (_enum_value ? "NT_AUXV (6)" : "NT_AUXV");
+		case ELF_Def::Constants::nhdr_type::NT_GWINDOWS: return os << (_enum_value ? "NT_GWINDOWS (7)" : "NT_GWINDOWS");
+		case ELF_Def::Constants::nhdr_type::NT_ASRS: return os << (_enum_value ? "NT_ASRS (8)" : "NT_ASRS");
+		case ELF_Def::Constants::nhdr_type::NT_PSTATUS: return os << (_enum_value ? "NT_PSTATUS (10)" : "NT_PSTATUS");
+		case ELF_Def::Constants::nhdr_type::NT_PSINFO: return os << (_enum_value ? "NT_PSINFO (13)" : "NT_PSINFO");
+		case ELF_Def::Constants::nhdr_type::NT_PRCRED: return os << (_enum_value ? "NT_PRCRED (14)" : "NT_PRCRED");
+		case ELF_Def::Constants::nhdr_type::NT_UTSNAME: return os << (_enum_value ? "NT_UTSNAME (15)" : "NT_UTSNAME");
+		case ELF_Def::Constants::nhdr_type::NT_LWPSTATUS: return os << (_enum_value ? "NT_LWPSTATUS (16)" : "NT_LWPSTATUS");
+		case ELF_Def::Constants::nhdr_type::NT_LWPSINFO: return os << (_enum_value ? "NT_LWPSINFO (17)" : "NT_LWPSINFO");
+		case ELF_Def::Constants::nhdr_type::NT_PRFPXREG: return os << (_enum_value ? "NT_PRFPXREG (20)" : "NT_PRFPXREG");
+		case ELF_Def::Constants::nhdr_type::NT_SIGINFO: return os << (_enum_value ? "NT_SIGINFO (0x53494749)" : "NT_SIGINFO");
+		case ELF_Def::Constants::nhdr_type::NT_FILE: return os << (_enum_value ? "NT_FILE (0x46494c45)" : "NT_FILE");
+		case ELF_Def::Constants::nhdr_type::NT_PRXFPREG: return os << (_enum_value ? "NT_PRXFPREG (0x46e62b7f)" : "NT_PRXFPREG");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_VMX: return os << (_enum_value ? "NT_PPC_VMX (0x100)" : "NT_PPC_VMX");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_SPE: return os << (_enum_value ? "NT_PPC_SPE (0x101)" : "NT_PPC_SPE");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_VSX: return os << (_enum_value ? "NT_PPC_VSX (0x102)" : "NT_PPC_VSX");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TAR: return os << (_enum_value ? "NT_PPC_TAR (0x103)" : "NT_PPC_TAR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_PPR: return os << (_enum_value ? "NT_PPC_PPR (0x104)" : "NT_PPC_PPR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_DSCR: return os << (_enum_value ? "NT_PPC_DSCR (0x105)" : "NT_PPC_DSCR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_EBB: return os << (_enum_value ? "NT_PPC_EBB (0x106)" : "NT_PPC_EBB");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_PMU: return os << (_enum_value ? "NT_PPC_PMU (0x107)" : "NT_PPC_PMU");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CGPR: return os << (_enum_value ? "NT_PPC_TM_CGPR (0x108)" : "NT_PPC_TM_CGPR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CFPR: return os << (_enum_value ? "NT_PPC_TM_CFPR (0x109)" : "NT_PPC_TM_CFPR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CVMX: return os << (_enum_value ? "NT_PPC_TM_CVMX (0x10a)" : "NT_PPC_TM_CVMX");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CVSX: return os << (_enum_value ? "NT_PPC_TM_CVSX (0x10b)" : "NT_PPC_TM_CVSX");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_SPR: return os << (_enum_value ? "NT_PPC_TM_SPR (0x10c)" : "NT_PPC_TM_SPR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CTAR: return os << (_enum_value ? "NT_PPC_TM_CTAR (0x10d)" : "NT_PPC_TM_CTAR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CPPR: return os << (_enum_value ? "NT_PPC_TM_CPPR (0x10e)" : "NT_PPC_TM_CPPR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_TM_CDSCR: return os << (_enum_value ? "NT_PPC_TM_CDSCR (0x10f)" : "NT_PPC_TM_CDSCR");
+		case ELF_Def::Constants::nhdr_type::NT_PPC_PKEY: return os << (_enum_value ? "NT_PPC_PKEY (0x110)" : "NT_PPC_PKEY");
+		case ELF_Def::Constants::nhdr_type::NT_386_TLS: return os << (_enum_value ? "NT_386_TLS (0x200)" : "NT_386_TLS");
+		case ELF_Def::Constants::nhdr_type::NT_386_IOPERM: return os << (_enum_value ? "NT_386_IOPERM (0x201)" : "NT_386_IOPERM");
+		case ELF_Def::Constants::nhdr_type::NT_X86_XSTATE: return os << (_enum_value ? "NT_X86_XSTATE (0x202)" : "NT_X86_XSTATE");
+		case ELF_Def::Constants::nhdr_type::NT_S390_HIGH_GPRS: return os << (_enum_value ? "NT_S390_HIGH_GPRS (0x300)" : "NT_S390_HIGH_GPRS");
+		case ELF_Def::Constants::nhdr_type::NT_S390_TIMER: return os << (_enum_value ? "NT_S390_TIMER (0x301)" : "NT_S390_TIMER");
+		case ELF_Def::Constants::nhdr_type::NT_S390_TODCMP: return os << (_enum_value ? "NT_S390_TODCMP (0x302)" : "NT_S390_TODCMP");
+		case ELF_Def::Constants::nhdr_type::NT_S390_TODPREG: return os << (_enum_value ? "NT_S390_TODPREG (0x303)" : "NT_S390_TODPREG");
+		case ELF_Def::Constants::nhdr_type::NT_S390_CTRS: return os << (_enum_value ? "NT_S390_CTRS (0x304)" : "NT_S390_CTRS");
+		case ELF_Def::Constants::nhdr_type::NT_S390_PREFIX: return os << (_enum_value ? "NT_S390_PREFIX (0x305)" : "NT_S390_PREFIX");
+		case ELF_Def::Constants::nhdr_type::NT_S390_LAST_BREAK: return os << (_enum_value ? "NT_S390_LAST_BREAK (0x306)" : "NT_S390_LAST_BREAK");
+		case ELF_Def::Constants::nhdr_type::NT_S390_SYSTEM_CALL: return os << (_enum_value ? "NT_S390_SYSTEM_CALL (0x307)" : "NT_S390_SYSTEM_CALL");
+		case ELF_Def::Constants::nhdr_type::NT_S390_TDB: return os << (_enum_value ? "NT_S390_TDB (0x308)" : "NT_S390_TDB");
+		case ELF_Def::Constants::nhdr_type::NT_S390_VXRS_LOW: return os << (_enum_value ? "NT_S390_VXRS_LOW (0x309)" : "NT_S390_VXRS_LOW");
+		case ELF_Def::Constants::nhdr_type::NT_S390_VXRS_HIGH: return os << (_enum_value ? "NT_S390_VXRS_HIGH (0x30a)" : "NT_S390_VXRS_HIGH");
+		case ELF_Def::Constants::nhdr_type::NT_S390_GS_CB: return os << (_enum_value ? "NT_S390_GS_CB (0x30b)" : "NT_S390_GS_CB");
+		case ELF_Def::Constants::nhdr_type::NT_S390_GS_BC: return os << (_enum_value ? "NT_S390_GS_BC (0x30c)" : "NT_S390_GS_BC");
+		case ELF_Def::Constants::nhdr_type::NT_S390_RI_CB: return os << (_enum_value ? "NT_S390_RI_CB (0x30d)" : "NT_S390_RI_CB");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_VFP: return os << (_enum_value ? "NT_ARM_VFP (0x400)" : "NT_ARM_VFP");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_TLS: return os << (_enum_value ? "NT_ARM_TLS (0x401)" : "NT_ARM_TLS");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_HW_BREAK: return os << (_enum_value ? "NT_ARM_HW_BREAK (0x402)" : "NT_ARM_HW_BREAK");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_HW_WATCH: return os << (_enum_value ? "NT_ARM_HW_WATCH (0x403)" : "NT_ARM_HW_WATCH");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_SYSTEM_CALL: return os << (_enum_value ? "NT_ARM_SYSTEM_CALL (0x404)" : "NT_ARM_SYSTEM_CALL");
+		case ELF_Def::Constants::nhdr_type::NT_ARM_SVE: return os << (_enum_value ? "NT_ARM_SVE (0x405)" : "NT_ARM_SVE");
+		case ELF_Def::Constants::nhdr_type::NT_VMCOREDD: return os << (_enum_value ? "NT_VMCOREDD (0x700)" : "NT_VMCOREDD");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::nhdr_type)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::nhdr_type _enum_values_nhdr_type[] = {ELF_Def::Constants::nhdr_type ::NT_386_IOPERM , ELF_Def::Constants::nhdr_type ::NT_386_TLS , ELF_Def::Constants::nhdr_type ::NT_ARCH , ELF_Def::Constants::nhdr_type ::NT_ARM_HW_BREAK , ELF_Def::Constants::nhdr_type ::NT_ARM_HW_WATCH , ELF_Def::Constants::nhdr_type ::NT_ARM_SVE , ELF_Def::Constants::nhdr_type ::NT_ARM_SYSTEM_CALL , ELF_Def::Constants::nhdr_type ::NT_ARM_TLS , ELF_Def::Constants::nhdr_type ::NT_ARM_VFP , ELF_Def::Constants::nhdr_type ::NT_ASRS , ELF_Def::Constants::nhdr_type ::NT_AUXV , ELF_Def::Constants::nhdr_type ::NT_FILE , ELF_Def::Constants::nhdr_type ::NT_GWINDOWS , ELF_Def::Constants::nhdr_type ::NT_LWPSINFO , ELF_Def::Constants::nhdr_type ::NT_LWPSTATUS , ELF_Def::Constants::nhdr_type ::NT_PLATFORM , ELF_Def::Constants::nhdr_type ::NT_PPC_DSCR , ELF_Def::Constants::nhdr_type ::NT_PPC_EBB , ELF_Def::Constants::nhdr_type ::NT_PPC_PKEY , ELF_Def::Constants::nhdr_type ::NT_PPC_PMU , ELF_Def::Constants::nhdr_type ::NT_PPC_PPR , ELF_Def::Constants::nhdr_type ::NT_PPC_SPE , ELF_Def::Constants::nhdr_type ::NT_PPC_TAR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CDSCR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CFPR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CGPR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CPPR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CTAR , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CVMX , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_CVSX , ELF_Def::Constants::nhdr_type ::NT_PPC_TM_SPR , ELF_Def::Constants::nhdr_type ::NT_PPC_VMX , ELF_Def::Constants::nhdr_type ::NT_PPC_VSX , ELF_Def::Constants::nhdr_type ::NT_PRCRED , ELF_Def::Constants::nhdr_type ::NT_PRFPXREG , ELF_Def::Constants::nhdr_type ::NT_PRPSINFO , ELF_Def::Constants::nhdr_type ::NT_PRXFPREG , ELF_Def::Constants::nhdr_type ::NT_PRXREG , ELF_Def::Constants::nhdr_type ::NT_PSINFO , ELF_Def::Constants::nhdr_type ::NT_PSTATUS , ELF_Def::Constants::nhdr_type ::NT_S390_CTRS , ELF_Def::Constants::nhdr_type ::NT_S390_GS_BC , ELF_Def::Constants::nhdr_type ::NT_S390_GS_CB , ELF_Def::Constants::nhdr_type ::NT_S390_HIGH_GPRS , ELF_Def::Constants::nhdr_type ::NT_S390_LAST_BREAK , ELF_Def::Constants::nhdr_type ::NT_S390_PREFIX , ELF_Def::Constants::nhdr_type ::NT_S390_RI_CB , ELF_Def::Constants::nhdr_type ::NT_S390_SYSTEM_CALL , ELF_Def::Constants::nhdr_type ::NT_S390_TDB , ELF_Def::Constants::nhdr_type ::NT_S390_TIMER , ELF_Def::Constants::nhdr_type ::NT_S390_TODCMP , ELF_Def::Constants::nhdr_type ::NT_S390_TODPREG , ELF_Def::Constants::nhdr_type ::NT_S390_VXRS_HIGH , ELF_Def::Constants::nhdr_type ::NT_S390_VXRS_LOW , ELF_Def::Constants::nhdr_type ::NT_SIGINFO , ELF_Def::Constants::nhdr_type ::NT_UTSNAME , ELF_Def::Constants::nhdr_type ::NT_VERSION , ELF_Def::Constants::nhdr_type ::NT_VMCOREDD , ELF_Def::Constants::nhdr_type ::NT_X86_XSTATE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::verdef_version val) {
+	switch(val) {
+		case ELF_Def::Constants::verdef_version::VER_DEF_NONE: return os << (_enum_value ? "VER_DEF_NONE (0)" : "VER_DEF_NONE");
+		case ELF_Def::Constants::verdef_version::VER_DEF_CURRENT: return os << (_enum_value ? "VER_DEF_CURRENT (1)" : "VER_DEF_CURRENT");
+		case ELF_Def::Constants::verdef_version::VER_DEF_NUM: return os << (_enum_value ? "VER_DEF_NUM (2)" : "VER_DEF_NUM");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::verdef_version)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::verdef_version _enum_values_verdef_version[] = {ELF_Def::Constants::verdef_version ::VER_DEF_CURRENT , ELF_Def::Constants::verdef_version ::VER_DEF_NONE , ELF_Def::Constants::verdef_version ::VER_DEF_NUM };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::verdef_ndx val) {
+	switch(val) {
+		case ELF_Def::Constants::verdef_ndx::VER_NDX_LOCAL: return os << (_enum_value ? "VER_NDX_LOCAL (0)" : "VER_NDX_LOCAL");
+		case ELF_Def::Constants::verdef_ndx::VER_NDX_GLOBAL: return os << (_enum_value ? "VER_NDX_GLOBAL (1)" : "VER_NDX_GLOBAL");
+		case ELF_Def::Constants::verdef_ndx::VER_NDX_LORESERVE: return os << (_enum_value ? "VER_NDX_LORESERVE (0xff00)" : "VER_NDX_LORESERVE");
+		case ELF_Def::Constants::verdef_ndx::VER_NDX_ELIMINATE: return os << (_enum_value ? "VER_NDX_ELIMINATE (0xff01)" : "VER_NDX_ELIMINATE");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::verdef_ndx)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::verdef_ndx _enum_values_verdef_ndx[] = {ELF_Def::Constants::verdef_ndx ::VER_NDX_ELIMINATE , ELF_Def::Constants::verdef_ndx ::VER_NDX_GLOBAL , ELF_Def::Constants::verdef_ndx ::VER_NDX_LOCAL , ELF_Def::Constants::verdef_ndx ::VER_NDX_LORESERVE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Constants::verneed_version val) {
+	switch(val) {
+		case ELF_Def::Constants::verneed_version::VER_NEED_NONE: return os << (_enum_value ? "VER_NEED_NONE (0)" : "VER_NEED_NONE");
+		case ELF_Def::Constants::verneed_version::VER_NEED_CURRENT: return os << (_enum_value ? "VER_NEED_CURRENT (1)" : "VER_NEED_CURRENT");
+		case ELF_Def::Constants::verneed_version::VER_NEED_NUM: return os << (_enum_value ? "VER_NEED_NUM (2)" : "VER_NEED_NUM");
+	}
+	if (_enum_value) os << "(ELF_Def::Constants::verneed_version)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Constants::verneed_version _enum_values_verneed_version[] = {ELF_Def::Constants::verneed_version ::VER_NEED_CURRENT , ELF_Def::Constants::verneed_version ::VER_NEED_NONE , ELF_Def::Constants::verneed_version ::VER_NEED_NUM };
+
@@ -0,0 +1,92 @@
+
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#pragma once
+
+#ifdef USE_DLH
+#include <dlh/types.hpp>
+#include <dlh/stream/buffer.hpp>
+#include <dlh/utility.hpp>
+using ostream = BufferStream;
+#else
+#include <cstdint>
+#include <ostream>
+using std::ostream;
+#endif
+
+#include "elfo/elf_def/ident.hpp"
+
+#ifndef _ENUM_VALUE
+#define _ENUM_VALUE 1
+static bool _enum_value = false;
+inline ostream& enum_value_show(ostream& os) { _enum_value = true; return os; }
+inline ostream& enum_value_hide(ostream& os) { _enum_value = false; return os; }
+#endif
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Identification::ident_class val) {
+	switch(val) {
+		case ELF_Def::Identification::ident_class::ELFCLASSNONE: return os << (_enum_value ? "ELFCLASSNONE (0)" : "ELFCLASSNONE");
+		case ELF_Def::Identification::ident_class::ELFCLASS32: return os << (_enum_value ? "ELFCLASS32 (1)" : "ELFCLASS32");
+		case ELF_Def::Identification::ident_class::ELFCLASS64: return os << (_enum_value ? "ELFCLASS64 (2)" : "ELFCLASS64");
+	}
+	if (_enum_value) os << "(ELF_Def::Identification::ident_class)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Identification::ident_class _enum_values_ident_class[] = {ELF_Def::Identification::ident_class ::ELFCLASS32 , ELF_Def::Identification::ident_class ::ELFCLASS64 , ELF_Def::Identification::ident_class ::ELFCLASSNONE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Identification::ident_data val) {
+	switch(val) {
+		case ELF_Def::Identification::ident_data::ELFDATANONE: return os << (_enum_value ? "ELFDATANONE (0)" : "ELFDATANONE");
+		case ELF_Def::Identification::ident_data::ELFDATA2LSB: return os << (_enum_value ? "ELFDATA2LSB (1)" : "ELFDATA2LSB");
+		case ELF_Def::Identification::ident_data::ELFDATA2MSB: return os << (_enum_value ? "ELFDATA2MSB (2)" : "ELFDATA2MSB");
+	}
+	if (_enum_value) os << "(ELF_Def::Identification::ident_data)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Identification::ident_data _enum_values_ident_data[] = {ELF_Def::Identification::ident_data ::ELFDATA2LSB , ELF_Def::Identification::ident_data ::ELFDATA2MSB , ELF_Def::Identification::ident_data ::ELFDATANONE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Identification::ident_version val) {
+	switch(val) {
+		case ELF_Def::Identification::ident_version::ELFVERSION_NONE: return os << (_enum_value ? "ELFVERSION_NONE (0)" : "ELFVERSION_NONE");
+		case ELF_Def::Identification::ident_version::ELFVERSION_CURRENT: return os << (_enum_value ? "ELFVERSION_CURRENT (1)" : "ELFVERSION_CURRENT");
+	}
+	if (_enum_value) os << "(ELF_Def::Identification::ident_version)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Identification::ident_version _enum_values_ident_version[] = {ELF_Def::Identification::ident_version ::ELFVERSION_CURRENT , ELF_Def::Identification::ident_version ::ELFVERSION_NONE };
+
+
+inline ostream& operator<<(ostream& os, ELF_Def::Identification::ident_abi val) {
+	switch(val) {
+		case ELF_Def::Identification::ident_abi::ELFOSABI_NONE: return os << (_enum_value ? "ELFOSABI_NONE (0)" : "ELFOSABI_NONE");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_HPUX: return os << (_enum_value ? "ELFOSABI_HPUX (1)" : "ELFOSABI_HPUX");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_NETBSD: return os << (_enum_value ? "ELFOSABI_NETBSD (2)" : "ELFOSABI_NETBSD");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_LINUX: return os << (_enum_value ? "ELFOSABI_LINUX (3)" : "ELFOSABI_LINUX");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_SOLARIS: return os << (_enum_value ? "ELFOSABI_SOLARIS (6)" : "ELFOSABI_SOLARIS");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_AIX: return os << (_enum_value ? "ELFOSABI_AIX (7)" : "ELFOSABI_AIX");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_IRIX: return os << (_enum_value ? "ELFOSABI_IRIX (8)" : "ELFOSABI_IRIX");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_FREEBSD: return os << (_enum_value ? "ELFOSABI_FREEBSD (9)" : "ELFOSABI_FREEBSD");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_TRU64: return os << (_enum_value ? "ELFOSABI_TRU64 (10)" : "ELFOSABI_TRU64");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_MODESTO: return os << (_enum_value ? "ELFOSABI_MODESTO (11)" : "ELFOSABI_MODESTO");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_OPENBSD: return os << (_enum_value ? "ELFOSABI_OPENBSD (12)" : "ELFOSABI_OPENBSD");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_OPENVMS: return os << (_enum_value ? "ELFOSABI_OPENVMS (13)" : "ELFOSABI_OPENVMS");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_NSK: return os << (_enum_value ? "ELFOSABI_NSK (14)" : "ELFOSABI_NSK");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_AROS: return os << (_enum_value ? "ELFOSABI_AROS (15)" : "ELFOSABI_AROS");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_FENIXOS: return os << (_enum_value ? "ELFOSABI_FENIXOS (16)" : "ELFOSABI_FENIXOS");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_ARM: return os << (_enum_value ? "ELFOSABI_ARM (97)" : "ELFOSABI_ARM");
+		case ELF_Def::Identification::ident_abi::ELFOSABI_STANDALONE: return os << (_enum_value ? "ELFOSABI_STANDALONE (255)" : "ELFOSABI_STANDALONE");
+	}
+	if (_enum_value) os << "(ELF_Def::Identification::ident_abi)";
+	return os << static_cast<uintptr_t>(val);
+}
+
+static ELF_Def::Identification::ident_abi _enum_values_ident_abi[] = {ELF_Def::Identification::ident_abi ::ELFOSABI_AIX , ELF_Def::Identification::ident_abi ::ELFOSABI_ARM , ELF_Def::Identification::ident_abi ::ELFOSABI_AROS , ELF_Def::Identification::ident_abi ::ELFOSABI_FENIXOS , ELF_Def::Identification::ident_abi ::ELFOSABI_FREEBSD , ELF_Def::Identification::ident_abi ::ELFOSABI_HPUX , ELF_Def::Identification::ident_abi ::ELFOSABI_IRIX , ELF_Def::Identification::ident_abi ::ELFOSABI_LINUX , ELF_Def::Identification::ident_abi ::ELFOSABI_MODESTO , ELF_Def::Identification::ident_abi ::ELFOSABI_NETBSD , ELF_Def::Identification::ident_abi ::ELFOSABI_NONE , ELF_Def::Identification::ident_abi ::ELFOSABI_NSK , ELF_Def::Identification::ident_abi ::ELFOSABI_OPENBSD , ELF_Def::Identification::ident_abi ::ELFOSABI_OPENVMS , ELF_Def::Identification::ident_abi ::ELFOSABI_SOLARIS , ELF_Def::Identification::ident_abi ::ELFOSABI_STANDALONE , ELF_Def::Identification::ident_abi ::ELFOSABI_TRU64 };
+
@@ -0,0 +1,1166 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#ifdef USE_DLH
+#include <dlh/container/vector.hpp>
+#include <dlh/stream/output.hpp>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <iostream>
+#include <vector>
+template<class T>
+using Vector = std::vector<T, std::allocator<T>>;
+using std::cerr;
+using std::cout;
+using std::dec;
+using std::endl;
+using std::hex;
+#endif
+
+#include <elfo/elf.hpp>
+#include <elfo/elf_addr.hpp>
+#include <elfo/elf_dirty.hpp>
+#include <elfo/elf_gnuhash.hpp>
+#include <elfo/elf_plt.hpp>
+#include <elfo/elf_rel.hpp>
+#include <elfo/elf_rel_parallel.hpp>
+#include <elfo/elf_scope.hpp>
+#include <elfo/elf_snapshot.hpp>
+#include <elfo/elf_verify.hpp>
+#include <elfo/elf_version.hpp>
+
+#include "elf_dyn.hpp"
+
+/*! \brief Current time stamp (in nanoseconds) */
+static uint64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint64_t>(ts.tv_sec) * 1000000000UL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/*! \brief Number of threads for parallel benchmarks */
+static const size_t workers = 4;
+
+/*! \brief Print result of a benchmark run */
+static void report(const char * name, uint64_t duration, size_t operations) {
+	cout << "  " << name << ": " << dec << (duration / 1000) << " us (" << (operations == 0 ? 0 : duration / operations) << " ns per operation)" << endl;
+}
+
+/*! \brief Cost of decoding the dynamic section (as done by \ref ELF_Dyn and by each getter) */
+template<ELFCLASS C>
+static bool bench_dynamic(const ELF<C> & elf, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty())
+		return true;
+	const size_t iterations = rounds * 100;
+	cout << "Dynamic section (" << dyn.count() << " entries, " << iterations << " iterations):" << endl;
+
+	uint64_t start = now();
+	size_t checksum = 0;
+	for (size_t i = 0; i < iterations; i++) {
+		const ELF_Dyn<C> dynamic(reinterpret_cast<uintptr_t>(&elf.header));
+		checksum += dynamic.relocations.count() + dynamic.relocations_plt.count();
+	}
+	report("ELF_Dyn()  ", now() - start, iterations);
+
+	start = now();
+	for (size_t i = 0; i < iterations; i++)
+		checksum += elf.dynamic().count();
+	report("dynamic()  ", now() - start, iterations);
+
+	using LoadMap = typename ELF<C>::LoadMap;
+	const LoadMap loads(elf);
+	start = now();
+	for (size_t i = 0; i < iterations; i++)
+		checksum += elf.dynamic(loads).count();
+	report("dynamic(loads)", now() - start, iterations);
+
+	start = now();
+	for (size_t i = 0; i < iterations; i++)
+		checksum += dyn.get_symbols().count() + dyn.get_relocations().count() + dyn.get_relocations_plt().count()
+		          + dyn.get_relative_relocations().offset_count() + dyn.get_init_array().count() + dyn.get_fini_array().count()
+		          + (dyn.get_soname() == nullptr ? 0 : 1) + (dyn.get_global_offset_table_pointer() == nullptr ? 0 : 1)
+		          + dyn[ELF<C>::DT_STRTAB].value() + dyn.get_symbol_table().count();
+	report("getters    ", now() - start, iterations * 10);
+
+	const auto dyn_loads = elf.dynamic(loads);
+	start = now();
+	for (size_t i = 0; i < iterations; i++)
+		checksum += dyn_loads.get_symbols().count() + dyn_loads.get_relocations().count() + dyn_loads.get_relocations_plt().count()
+		          + dyn_loads.get_relative_relocations().offset_count() + dyn_loads.get_init_array().count() + dyn_loads.get_fini_array().count()
+		          + (dyn_loads.get_soname() == nullptr ? 0 : 1) + (dyn_loads.get_global_offset_table_pointer() == nullptr ? 0 : 1)
+		          + dyn_loads[ELF<C>::DT_STRTAB].value() + dyn_loads.get_symbol_table().count();
+	report("getters [loads]", now() - start, iterations * 10);
+
+	// Address translation (using the relocation targets, which are spread over the writable segments)
+	Vector<uintptr_t> vaddrs;
+	for (const auto & r : dyn.get_relocations())
+		vaddrs.push_back(r.offset());
+	for (const auto & r : dyn.get_relocations_plt())
+		vaddrs.push_back(r.offset());
+	if (!vaddrs.empty()) {
+		Vector<uintptr_t> linear(vaddrs.size());
+		Vector<uintptr_t> indexed(vaddrs.size());
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < vaddrs.size(); i++) {
+				linear[i] = 0;
+				for (const auto & s : elf.segments)
+					if (s.type() == ELF<C>::PT_LOAD && vaddrs[i] >= s.virt_addr() && vaddrs[i] <= s.virt_addr() + s.size()) {
+						linear[i] = vaddrs[i] + s.offset() - s.virt_addr();
+						break;
+					}
+			}
+		report("translate [linear]", now() - start, rounds * vaddrs.size());
+
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			loads.translate(vaddrs.data(), indexed.data(), vaddrs.size());
+		report("translate [sorted]", now() - start, rounds * vaddrs.size());
+
+		for (size_t i = 0; i < vaddrs.size(); i++)
+			if (linear[i] != indexed[i]) {
+				cerr << "Translation of " << vaddrs[i] << " differs: " << linear[i] << " vs. " << indexed[i] << endl;
+				return false;
+			}
+	}
+	cout << "  (checksum " << checksum << ")" << endl;
+	return true;
+}
+
+/*! \brief Compare section lookup by name with scanning the section header table */
+template<ELFCLASS C>
+static bool bench_sections(const ELF<C> & elf, size_t rounds) {
+	if (elf.sections.count() <= 1)
+		return true;
+	const size_t iterations = rounds * 10;
+	cout << "Section lookup (" << elf.sections.count() << " sections, " << iterations << " iterations):" << endl;
+
+	Vector<const char *> names;
+	for (size_t i = 1; i < elf.sections.count(); i++)
+		names.push_back(elf.sections[i].name());
+
+	uint64_t start = now();
+	size_t linear = 0;
+	for (size_t r = 0; r < iterations; r++)
+		for (const auto name : names)
+			for (size_t i = 1; i < elf.sections.count(); i++)
+				if (strcmp(elf.sections[i].name(), name) == 0) {
+					linear += i;
+					break;
+				}
+	report("name [linear]   ", now() - start, iterations * names.size());
+
+	Vector<typename ELF<C>::SectionDirectory::Entry> entries(ELF<C>::SectionDirectory::entries(elf));
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		typename ELF<C>::SectionDirectory{elf, entries.data(), entries.size()};
+	report("directory [build]", now() - start, rounds);
+	const typename ELF<C>::SectionDirectory sections(elf, entries.data(), entries.size());
+
+	start = now();
+	size_t directory = 0;
+	for (size_t r = 0; r < iterations; r++)
+		for (const auto name : names)
+			directory += sections.find(name);
+	report("find() [directory]", now() - start, iterations * names.size());
+
+	if (linear != directory) {
+		cerr << "Section lookup mismatch" << endl;
+		return false;
+	}
+
+	start = now();
+	size_t symbols = 0;
+	for (size_t r = 0; r < iterations; r++)
+		symbols += elf.symbol_table().count();
+	report("symbol_table()  ", now() - start, iterations);
+
+	start = now();
+	for (size_t r = 0; r < iterations; r++)
+		symbols += sections.symbol_table().count();
+	report("symbol_table() [directory]", now() - start, iterations);
+	cout << "  (checksum " << directory + symbols << ")" << endl;
+	return true;
+}
+
+/*! \brief Compare single symbol lookups with batched lookups in the dynamic symbol table */
+template<ELFCLASS C>
+static bool bench_lookup(const ELF<C> & elf, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty()) {
+		cout << "Symbol lookup: no dynamic section" << endl;
+		return true;
+	}
+	const auto symbols = dyn.get_symbol_table();
+
+	Vector<const char *> names;
+	for (size_t i = 1; i < symbols.count(); i++)
+		names.push_back(symbols.name(i));
+	if (names.empty()) {
+		cout << "Symbol lookup: no dynamic symbols" << endl;
+		return true;
+	}
+
+	// Shuffle (deterministic) to avoid sequential access of the symbol table
+	uint32_t seed = 42;
+	for (size_t i = names.size() - 1; i > 0; i--) {
+		seed = seed * 1103515245 + 12345;
+		size_t j = seed % (i + 1);
+		const char * tmp = names[i];
+		names[i] = names[j];
+		names[j] = tmp;
+	}
+	Vector<uint32_t> single(names.size());
+	Vector<uint32_t> batch(names.size());
+
+	cout << "Symbol lookup (" << names.size() << " names, " << rounds << " rounds):" << endl;
+
+	uint64_t start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < names.size(); i++)
+			single[i] = static_cast<uint32_t>(symbols.index(names[i]));
+	report("index()     ", now() - start, rounds * names.size());
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		symbols.index_many(names.data(), names.size(), batch.data());
+	report("index_many()", now() - start, rounds * names.size());
+
+	for (size_t i = 0; i < names.size(); i++)
+		if (single[i] != batch[i]) {
+			cerr << "Lookup mismatch for '" << names[i] << "': " << single[i] << " vs. " << batch[i] << endl;
+			return false;
+		}
+
+	// Keys with precomputed hashes (as with constexpr keys for fixed names)
+	Vector<ELF_Def::SymbolKey> keys;
+	for (size_t i = 0; i < names.size(); i++)
+		keys.push_back(ELF_Def::SymbolKey(names[i]));
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < keys.size(); i++)
+			batch[i] = static_cast<uint32_t>(symbols.index(keys[i]));
+	report("index(key)  ", now() - start, rounds * names.size());
+
+	for (size_t i = 0; i < names.size(); i++)
+		if (single[i] != batch[i]) {
+			cerr << "Key lookup mismatch for '" << names[i] << "': " << single[i] << " vs. " << batch[i] << endl;
+			return false;
+		}
+
+	// Bulk version check (any, default and own version of each symbol) compared with the lookup
+	const uint16_t any_version = ELF<C>::VER_NDX_GLOBAL;
+	const uint16_t default_version = ELF<C>::SymbolTable::default_version;
+	for (uint16_t required : { any_version, default_version, static_cast<uint16_t>(0) }) {
+		Vector<uint16_t> versym;
+		Vector<uint16_t> required_versions;
+		for (uint32_t i = 0; i < symbols.count(); i++) {
+			versym.push_back(symbols.versions == nullptr ? any_version : symbols.versions[i]);
+			required_versions.push_back(required == 0 ? symbols.version(i) : required);
+		}
+		Vector<uint8_t> checked(versym.size());
+		VersionTable<C>::check(symbols.versions == nullptr ? nullptr : versym.data(), required_versions.data(), versym.size(), reinterpret_cast<bool *>(checked.data()));
+		for (uint32_t i = 1; i < symbols.count(); i++) {
+			const size_t found = symbols.index(symbols.name(i), required_versions[i]);
+			const bool defined = symbols[i].section_index() != ELF<C>::SHN_UNDEF;
+			if ((found == i && checked[i] == 0) || (defined && checked[i] != 0 && found == ELF<C>::STN_UNDEF)) {
+				cerr << "Version check mismatch for '" << symbols.name(i) << "' (required version " << required_versions[i] << ")" << endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/*! \brief Compare scalar with bulk (SIMD) hashing of all dynamic symbol names */
+template<ELFCLASS C>
+static bool bench_hash(const ELF<C> & elf, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty())
+		return true;
+	const auto symbols = dyn.get_symbol_table();
+
+	Vector<const char *> names;
+	for (size_t i = 1; i < symbols.count(); i++)
+		names.push_back(symbols.name(i));
+	if (names.empty())
+		return true;
+	Vector<uint32_t> single(names.size());
+	Vector<uint32_t> bulk(names.size());
+	Vector<uint32_t> lengths(names.size());
+
+	cout << "ELF hash (" << names.size() << " names, " << rounds << " rounds):" << endl;
+	uint64_t start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < names.size(); i++)
+			single[i] = ELF_Def::hash(names[i]);
+	report("hash()          ", now() - start, rounds * names.size());
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		ELF_Def::hash_bulk(names.data(), names.size(), bulk.data(), lengths.data());
+	report("hash_bulk()     ", now() - start, rounds * names.size());
+
+	for (size_t i = 0; i < names.size(); i++)
+		if (single[i] != bulk[i] || lengths[i] != strlen(names[i])) {
+			cerr << "ELF hash mismatch for '" << names[i] << "'" << endl;
+			return false;
+		}
+
+	cout << "GNU hash (" << names.size() << " names, " << rounds << " rounds):" << endl;
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < names.size(); i++)
+			single[i] = static_cast<uint32_t>(ELF_Def::gnuhash(names[i]));
+	report("gnuhash()       ", now() - start, rounds * names.size());
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		ELF_Def::gnuhash_bulk(names.data(), names.size(), bulk.data(), lengths.data());
+	report("gnuhash_bulk()  ", now() - start, rounds * names.size());
+
+	for (size_t i = 0; i < names.size(); i++)
+		if (single[i] != bulk[i] || lengths[i] != strlen(names[i])) {
+			cerr << "GNU hash mismatch for '" << names[i] << "'" << endl;
+			return false;
+		}
+	return true;
+}
+
+/*! \brief Compare linear string comparison with the auxiliary lookup index and a generated GNU hash table in (non-dynamic) symbol tables */
+template<ELFCLASS C>
+static bool bench_symtab(const ELF<C> & elf, size_t rounds) {
+	for (auto & section : elf.sections) {
+		if (section.type() != ELF<C>::SHT_SYMTAB)
+			continue;
+		auto symbols = section.get_symbol_table();
+		if (symbols.count() <= 1)
+			continue;
+
+		// Limit number of names for the (slow) linear search
+		Vector<const char *> names;
+		const size_t stride = symbols.count() / 1000 + 1;
+		for (size_t i = 1; i < symbols.count(); i += stride)
+			names.push_back(symbols.name(i));
+		Vector<uint32_t> linear(names.size());
+		Vector<uint32_t> indexed(names.size());
+
+		cout << "Symbol table '" << section.name() << "' (" << symbols.count() << " symbols, " << names.size() << " names, " << rounds << " rounds):" << endl;
+
+		uint64_t start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < names.size(); i++)
+				linear[i] = static_cast<uint32_t>(symbols.index(names[i]));
+		report("index() [linear]     ", now() - start, rounds * names.size());
+
+		// Linear search with cached name lengths
+		Vector<uint32_t> lengths(symbols.count());
+		if (!symbols.build_name_lengths(lengths.data(), lengths.size())) {
+			cerr << "Unable to cache name lengths" << endl;
+			return false;
+		}
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < names.size(); i++)
+				indexed[i] = static_cast<uint32_t>(symbols.index(names[i]));
+		report("index() [lengths]    ", now() - start, rounds * names.size());
+
+		for (size_t i = 0; i < names.size(); i++)
+			if (linear[i] != indexed[i]) {
+				cerr << "Name length lookup mismatch for '" << names[i] << "': " << linear[i] << " vs. " << indexed[i] << endl;
+				return false;
+			}
+
+		Vector<typename ELF<C>::SymbolTable::IndexSlot> slots(symbols.lookup_index_slots());
+		start = now();
+		if (!symbols.build_lookup_index(slots.data(), slots.size())) {
+			cerr << "Unable to build lookup index" << endl;
+			return false;
+		}
+		report("build_lookup_index() ", now() - start, symbols.count());
+
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < names.size(); i++)
+				indexed[i] = static_cast<uint32_t>(symbols.index(names[i]));
+		report("index() [indexed]    ", now() - start, rounds * names.size());
+
+		for (size_t i = 0; i < names.size(); i++)
+			if (linear[i] != indexed[i]) {
+				cerr << "Lookup index mismatch for '" << names[i] << "': " << linear[i] << " vs. " << indexed[i] << endl;
+				return false;
+			}
+
+		// Generated GNU hash table (undefined symbols and empty names are not hashed)
+		start = now();
+		const auto parameters = GnuHashTable<C>::parameters(symbols);
+		Vector<uint64_t> buffer((GnuHashTable<C>::size(parameters) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+		const GnuHashTable<C> gnu_hash(symbols, buffer.data(), buffer.size() * sizeof(uint64_t), parameters);
+		report("GnuHashTable()       ", now() - start, symbols.count());
+
+		const auto hashed = gnu_hash.table();
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < names.size(); i++)
+				indexed[i] = static_cast<uint32_t>(hashed.index(names[i]));
+		report("index() [gnu hash]   ", now() - start, rounds * names.size());
+
+		for (size_t i = 0; i < names.size(); i++)
+			if (linear[i] != indexed[i] && names[i][0] != '\0' && !symbols[linear[i]].undefined()) {
+				cerr << "GNU hash table mismatch for '" << names[i] << "': " << linear[i] << " vs. " << indexed[i] << endl;
+				return false;
+			}
+	}
+	return true;
+}
+
+/*! \brief Compare single with batched (merge-join) address to symbol lookups */
+template<ELFCLASS C>
+static bool bench_address(const ELF<C> & elf, size_t rounds) {
+	for (auto & section : elf.sections) {
+		if (section.type() != ELF<C>::SHT_SYMTAB && section.type() != ELF<C>::SHT_DYNSYM)
+			continue;
+		const auto symbols = section.get_symbols();
+
+		uint64_t start = now();
+		Vector<typename AddressIndex<C>::Entry> entries(AddressIndex<C>::entries(symbols));
+		AddressIndex<C> index(symbols, entries.data(), entries.size());
+		const uint64_t build = now() - start;
+		if (index.count() == 0)
+			continue;
+
+		// Sorted addresses (in the middle of each function/object and in between)
+		Vector<uintptr_t> addresses;
+		for (size_t i = 0; i < entries.size(); i++) {
+			addresses.push_back(entries[i].start + (entries[i].end - entries[i].start) / 2);
+			addresses.push_back(entries[i].end);
+		}
+		Vector<uint32_t> single(addresses.size());
+		Vector<uint32_t> batch(addresses.size());
+
+		cout << "Address lookup in '" << section.name() << "' (" << index.count() << " symbols, " << addresses.size() << " addresses, " << rounds << " rounds):" << endl;
+		report("AddressIndex()", build, index.count());
+
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < addresses.size(); i++)
+				single[i] = index.index(addresses[i]);
+		report("index()       ", now() - start, rounds * addresses.size());
+
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			index.index_many(addresses.data(), addresses.size(), batch.data());
+		report("index_many()  ", now() - start, rounds * addresses.size());
+
+		for (size_t i = 0; i < addresses.size(); i++) {
+			if (single[i] != batch[i]) {
+				cerr << "Address lookup mismatch for " << addresses[i] << ": " << single[i] << " vs. " << batch[i] << endl;
+				return false;
+			} else if (single[i] != ELF<C>::STN_UNDEF) {
+				const auto sym = symbols[single[i]];
+				if (addresses[i] < sym.value() || addresses[i] >= sym.value() + sym.size()) {
+					cerr << "Address " << addresses[i] << " is not within symbol " << sym.name() << endl;
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/*! \brief Size of a memory image of all loadable segments */
+template<ELFCLASS C>
+static size_t image_size(const ELF<C> & elf) {
+	uintptr_t end = 0;
+	for (const auto & segment : elf.segments)
+		if (segment.type() == ELF<C>::PT_LOAD && segment.virt_addr() + segment.virt_size() > end)
+			end = segment.virt_addr() + segment.virt_size();
+	return end + sizeof(uint64_t);
+}
+
+/*! \brief Copy all loadable segments into a memory image (with at least \ref image_size bytes) */
+template<ELFCLASS C>
+static void load_image(const ELF<C> & elf, Vector<uint8_t> & image) {
+	for (size_t i = 0; i < image.size(); i++)
+		image[i] = 0;
+	for (const auto & segment : elf.segments)
+		if (segment.type() == ELF<C>::PT_LOAD)
+			memcpy(image.data() + segment.virt_addr(), segment.data(), segment.size());
+}
+
+/*! \brief Compare the iterator with bulk decoding and applying of relative relocations (`DT_RELR`) */
+template<ELFCLASS C>
+static bool bench_relr(const ELF<C> & elf, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty())
+		return true;
+	const auto relr = dyn.get_relative_relocations();
+	const size_t count = relr.offset_count();
+	if (count == 0)
+		return true;
+	Vector<uintptr_t> iterated(count);
+	Vector<uintptr_t> decoded(count);
+
+	cout << "Relative relocations (" << relr.count() << " entries, " << count << " offsets, " << rounds << " rounds):" << endl;
+
+	uint64_t start = now();
+	for (size_t r = 0; r < rounds; r++) {
+		size_t i = 0;
+		for (const auto & entry : relr)
+			iterated[i++] = entry.offset();
+	}
+	report("Iterator        ", now() - start, rounds * count);
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		if (relr.decode(decoded.data(), decoded.size()) != count) {
+			cerr << "Decoded relative relocation count mismatch" << endl;
+			return false;
+		}
+	report("decode()        ", now() - start, rounds * count);
+
+	for (size_t i = 0; i < count; i++)
+		if (iterated[i] != decoded[i]) {
+			cerr << "Relative relocation mismatch at " << i << ": " << hex << iterated[i] << " vs. " << decoded[i] << dec << endl;
+			return false;
+		}
+
+	// Random access to the n-th offset (prefix sums vs. walking the list)
+	using IndexedList = typename ELF<C>::IndexedRelocationRelativeList;
+	Vector<typename IndexedList::Index> index(relr.count());
+	start = now();
+	const IndexedList indexed(relr, index.data(), index.size());
+	report("Index [build]   ", now() - start, relr.count());
+
+	const size_t stride = count / 100 + 1;
+	start = now();
+	for (size_t i = 0; i < count; i += stride)
+		if (relr.at(i).offset() != decoded[i]) {
+			cerr << "Relative relocation mismatch at " << i << " (list)" << endl;
+			return false;
+		}
+	report("at() [list]     ", now() - start, (count + stride - 1) / stride);
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < count; i++)
+			if (indexed.at(i) != decoded[i]) {
+				cerr << "Relative relocation mismatch at " << i << " (index): " << hex << indexed.at(i) << " vs. " << decoded[i] << dec << endl;
+				return false;
+			}
+	report("at() [index]    ", now() - start, rounds * count);
+
+	// Apply to memory images (with each round relocating again)
+	using elfptr_t = typename ELF_Def::Structures<C>::Elf_Addr;
+	Vector<uint8_t> image(image_size(elf));
+	Vector<uint8_t> bulk_image(image.size());
+	load_image(elf, image);
+	load_image(elf, bulk_image);
+	const uintptr_t base = reinterpret_cast<uintptr_t>(image.data());
+	const uintptr_t bulk_base = reinterpret_cast<uintptr_t>(bulk_image.data());
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (const auto & entry : relr)
+			*reinterpret_cast<elfptr_t *>(base + entry.offset()) += static_cast<elfptr_t>(base);
+	report("Iterator [apply]", now() - start, rounds * count);
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		relr.apply_relative(bulk_base);
+	report("apply_relative()", now() - start, rounds * count);
+
+	Vector<uint8_t> parallel_image(image.size());
+	load_image(elf, parallel_image);
+	const uintptr_t parallel_base = reinterpret_cast<uintptr_t>(parallel_image.data());
+	const ParallelRelocator<C> relocator(elf, parallel_base);
+	Vector<typename ParallelRelocator<C>::Partition> partitions(4 * workers);
+	start = now();
+	for (size_t r = 0; r < rounds; r++) {
+		const size_t n = relocator.partition(relr, partitions.data(), partitions.size());
+		relocator.apply_relative(relr, partitions.data(), n, workers);
+	}
+	report("apply_relative() [parallel]", now() - start, rounds * count);
+
+	for (size_t i = 0; i < count; i++) {
+		const elfptr_t value = *reinterpret_cast<elfptr_t *>(base + decoded[i]) - static_cast<elfptr_t>(rounds * base);
+		const elfptr_t bulk_value = *reinterpret_cast<elfptr_t *>(bulk_base + decoded[i]) - static_cast<elfptr_t>(rounds * bulk_base);
+		const elfptr_t parallel_value = *reinterpret_cast<elfptr_t *>(parallel_base + decoded[i]) - static_cast<elfptr_t>(rounds * parallel_base);
+		if (value != bulk_value || value != parallel_value) {
+			cerr << "Applied relative relocation mismatch at " << hex << decoded[i] << dec << endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+/*! \brief Compare relocating each entry with the batched relocation of whole tables
+ * All symbols are resolved in the object itself, objects with indirect (IFUNC) relocations are skipped.
+ */
+template<ELFCLASS C>
+static bool bench_relocation(const ELF<C> & elf, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty())
+		return true;
+	using Relocation = typename ELF<C>::Relocation;
+	const typename ELF<C>::template Array<Relocation> tables[] = { dyn.get_relocations(), dyn.get_relocations_plt() };
+
+	size_t relocations = 0;
+	for (const auto & table : tables)
+		for (const auto & entry : table) {
+			if (Relocator<Relocation>::is_indirect(entry.type(), elf.header.machine()) || entry.symbol().type() == ELF<C>::STT_GNU_IFUNC) {
+				cout << "Relocation: skipping object with indirect functions" << endl;
+				return true;
+			}
+			relocations++;
+		}
+	if (relocations == 0)
+		return true;
+
+	Vector<uint8_t> image(image_size(elf));
+	Vector<uint8_t> batch_image(image.size());
+
+	cout << "Relocation (" << relocations << " relocations, " << rounds << " rounds):" << endl;
+
+	// Each entry with its own dispatch
+	uint64_t duration = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, image);
+		const uintptr_t base = reinterpret_cast<uintptr_t>(image.data());
+		const uint64_t start = now();
+		for (const auto & table : tables)
+			for (const auto & entry : table) {
+				const Relocator<Relocation> relocator(entry);
+				if (entry.symbol_index() == ELF<C>::STN_UNDEF)
+					relocator.fix_internal(base);
+				else
+					relocator.fix_value_external(base, entry.symbol(), relocator.value_external(base, entry.symbol(), base));
+			}
+		duration += now() - start;
+	}
+	report("Relocator         ", duration, rounds * relocations);
+
+	// Each entry with its own dispatch, but the machine resolved at compile time
+	if (elf.header.machine() == ELF<C>::EM_X86_64) {
+		duration = 0;
+		for (size_t r = 0; r < rounds; r++) {
+			load_image(elf, batch_image);
+			const uintptr_t base = reinterpret_cast<uintptr_t>(batch_image.data());
+			const uint64_t start = now();
+			for (const auto & table : tables)
+				for (const auto & entry : table) {
+					const Relocator<Relocation, ELF<C>::EM_X86_64> relocator(entry);
+					if (entry.symbol_index() == ELF<C>::STN_UNDEF)
+						relocator.fix_internal(base);
+					else
+						relocator.fix_value_external(base, entry.symbol(), relocator.value_external(base, entry.symbol(), base));
+				}
+			duration += now() - start;
+		}
+		report("Relocator [x86_64]", duration, rounds * relocations);
+	}
+
+	// Whole tables
+	duration = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, batch_image);
+		const uintptr_t base = reinterpret_cast<uintptr_t>(batch_image.data());
+		const BatchRelocator<C> relocator(elf, base);
+		auto resolve = [base](uint32_t, const typename ELF<C>::Symbol & symbol, typename BatchRelocator<C>::LookupClass) {
+			const uintptr_t value = symbol.type() == ELF<C>::STT_TLS ? symbol.value() : base + symbol.value();
+			return typename BatchRelocator<C>::Definition{ value, symbol.size(), 0, 0 };
+		};
+		const uint64_t start = now();
+		for (const auto & table : tables)
+			relocator.apply(table, resolve);
+		duration += now() - start;
+	}
+	report("BatchRelocator    ", duration, rounds * relocations);
+
+	// Whole tables, partitioned by target page
+	Vector<uint8_t> parallel_image(image.size());
+	Vector<typename ParallelRelocator<C>::Partition> partitions(4 * workers);
+	duration = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, parallel_image);
+		const uintptr_t base = reinterpret_cast<uintptr_t>(parallel_image.data());
+		const ParallelRelocator<C> relocator(elf, base);
+		auto resolve = [base](uint32_t, const typename ELF<C>::Symbol & symbol, typename BatchRelocator<C>::LookupClass) {
+			const uintptr_t value = symbol.type() == ELF<C>::STT_TLS ? symbol.value() : base + symbol.value();
+			return typename BatchRelocator<C>::Definition{ value, symbol.size(), 0, 0 };
+		};
+		const uint64_t start = now();
+		for (const auto & table : tables)
+			relocator.apply(table, resolve, partitions.data(), relocator.partition(table, partitions.data(), partitions.size()), workers);
+		duration += now() - start;
+	}
+	report("ParallelRelocator ", duration, rounds * relocations);
+
+	// Whole tables in the order of their targets
+	Vector<uint8_t> ordered_image(image.size());
+	Vector<uint32_t> order(relocations);
+	{
+		const uint64_t start = now();
+		size_t offset = 0;
+		for (const auto & table : tables) {
+			DirtyPages<C>::page_order(table, order.data() + offset);
+			offset += table.count();
+		}
+		report("Page order [sort] ", now() - start, relocations);
+	}
+	duration = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, ordered_image);
+		const uintptr_t base = reinterpret_cast<uintptr_t>(ordered_image.data());
+		const BatchRelocator<C> relocator(elf, base);
+		auto resolve = [base](uint32_t, const typename ELF<C>::Symbol & symbol, typename BatchRelocator<C>::LookupClass) {
+			const uintptr_t value = symbol.type() == ELF<C>::STT_TLS ? symbol.value() : base + symbol.value();
+			return typename BatchRelocator<C>::Definition{ value, symbol.size(), 0, 0 };
+		};
+		const uint64_t start = now();
+		size_t offset = 0;
+		for (const auto & table : tables) {
+			relocator.apply(table, resolve, order.data() + offset);
+			offset += table.count();
+		}
+		duration += now() - start;
+	}
+	report("BatchRelocator [page order]", duration, rounds * relocations);
+
+	// Snapshot of the batch relocated image, replayed (with the relative relocations applied separately)
+	const RelocationSnapshot<C> snapshot(elf);
+	const uint64_t fingerprint = RelocationSnapshot<C>::fingerprint(&elf, 1);
+	Vector<uint8_t> snapshot_data(snapshot.size(tables, sizeof(tables) / sizeof(tables[0])));
+	Vector<uint8_t> snapshot_image(image.size());
+	{
+		const uintptr_t base = reinterpret_cast<uintptr_t>(batch_image.data());
+		const typename RelocationSnapshot<C>::Dependency dependencies[] = { { base, batch_image.size() } };
+		auto resolve = [base](uint32_t, const typename ELF<C>::Symbol & symbol, typename BatchRelocator<C>::LookupClass) {
+			return typename RelocationSnapshot<C>::Definition{ base + symbol.value(), symbol.type() == ELF<C>::STT_TLS ? RelocationSnapshot<C>::absolute : static_cast<uint16_t>(0) };
+		};
+		const uint64_t start = now();
+		const size_t size = snapshot.record(tables, sizeof(tables) / sizeof(tables[0]), resolve, dependencies, 1, fingerprint, snapshot_data.data(), snapshot_data.size());
+		report("Snapshot [record] ", now() - start, relocations);
+		if (size == 0 || !snapshot.valid(snapshot_data.data(), size, fingerprint)) {
+			cerr << "Snapshot not valid" << endl;
+			return false;
+		}
+	}
+	duration = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, snapshot_image);
+		const uintptr_t base = reinterpret_cast<uintptr_t>(snapshot_image.data());
+		const BatchRelocator<C> relocator(elf, base);
+		const typename RelocationSnapshot<C>::Dependency dependencies[] = { { base, snapshot_image.size() } };
+		auto resolve = [](uint32_t, const typename ELF<C>::Symbol &, typename BatchRelocator<C>::LookupClass) {
+			return typename BatchRelocator<C>::Definition{ 0, 0, 0, 0 };
+		};
+		const uint64_t start = now();
+		for (const auto & table : tables)
+			relocator.apply(table, resolve, 0, table.count(), BatchRelocator<C>::RELATIVE);
+		snapshot.replay(snapshot_data.data(), dependencies, 1);
+		duration += now() - start;
+	}
+	report("Snapshot [replay] ", duration, rounds * relocations);
+
+	// Whole tables, resolving each symbol by name in the dynamic symbol table (without and with memoization)
+	const auto symbols = dyn.get_symbol_table();
+	Vector<uint8_t> lookup_image(image.size());
+	Vector<uint8_t> memo_image(image.size());
+	Vector<typename BatchRelocator<C>::Memo::Entry> memo_entries(BatchRelocator<C>::Memo::entries(dyn));
+	typename BatchRelocator<C>::Memo memo(memo_entries.data(), memo_entries.size());
+	for (int use_memo = 0; use_memo <= 1; use_memo++) {
+		Vector<uint8_t> & target = use_memo == 1 ? memo_image : lookup_image;
+		duration = 0;
+		for (size_t r = 0; r < rounds; r++) {
+			load_image(elf, target);
+			const uintptr_t base = reinterpret_cast<uintptr_t>(target.data());
+			const BatchRelocator<C> relocator(elf, base);
+			auto resolve = [base, &symbols](uint32_t, const typename ELF<C>::Symbol & symbol, typename BatchRelocator<C>::LookupClass) {
+				const uint32_t index = symbols.index(symbol.name());
+				const auto definition = index == ELF<C>::STN_UNDEF ? symbol : symbols[index];
+				const uintptr_t value = definition.type() == ELF<C>::STT_TLS ? definition.value() : base + definition.value();
+				return typename BatchRelocator<C>::Definition{ value, definition.size(), 0, 0 };
+			};
+			const uint64_t start = now();
+			memo.clear();
+			for (const auto & table : tables)
+				if (use_memo == 1)
+					relocator.apply(table, resolve, memo);
+				else
+					relocator.apply(table, resolve);
+			duration += now() - start;
+		}
+		report(use_memo == 1 ? "BatchRelocator [lookup, memo]" : "BatchRelocator [lookup]      ", duration, rounds * relocations);
+	}
+	cout << "    " << memo.lookups << " symbol resolutions, " << memo.hits << " memoized (" << memo.hit_rate() << "% hit rate)" << endl;
+	for (const auto & table : tables)
+		for (const auto & entry : table) {
+			const Relocator<Relocation> relocator(entry);
+			const uintptr_t lookup_base = reinterpret_cast<uintptr_t>(lookup_image.data());
+			const uintptr_t memo_base = reinterpret_cast<uintptr_t>(memo_image.data());
+			uintptr_t lookup = relocator.read_value(lookup_base);
+			uintptr_t memoized = relocator.read_value(memo_base);
+			if (lookup - lookup_base < image.size() && memoized - memo_base < image.size()) {
+				lookup -= lookup_base;
+				memoized -= memo_base;
+			}
+			if (lookup != memoized) {
+				cerr << "Memoized relocation mismatch at " << hex << entry.offset() << " (type " << dec << entry.type() << "): " << hex << lookup << " vs. " << memoized << dec << endl;
+				return false;
+			}
+		}
+
+	// Compare relocated images (values relative to the image base)
+	for (const auto & table : tables)
+		for (const auto & entry : table) {
+			const Relocator<Relocation> relocator(entry);
+			const uintptr_t single_base = reinterpret_cast<uintptr_t>(image.data());
+			const uintptr_t batch_base = reinterpret_cast<uintptr_t>(batch_image.data());
+			const uintptr_t parallel_base = reinterpret_cast<uintptr_t>(parallel_image.data());
+			const uintptr_t ordered_base = reinterpret_cast<uintptr_t>(ordered_image.data());
+			const uintptr_t snapshot_base = reinterpret_cast<uintptr_t>(snapshot_image.data());
+			uintptr_t single = relocator.read_value(single_base);
+			uintptr_t batch = relocator.read_value(batch_base);
+			uintptr_t parallel = relocator.read_value(parallel_base);
+			uintptr_t ordered = relocator.read_value(ordered_base);
+			uintptr_t replayed = relocator.read_value(snapshot_base);
+			if (single - single_base < image.size() && batch - batch_base < image.size() && parallel - parallel_base < image.size() && ordered - ordered_base < image.size() && replayed - snapshot_base < image.size()) {
+				single -= single_base;
+				batch -= batch_base;
+				parallel -= parallel_base;
+				ordered -= ordered_base;
+				replayed -= snapshot_base;
+			}
+			if (single != batch || single != parallel || single != ordered || single != replayed) {
+				cerr << "Relocation mismatch at " << hex << entry.offset() << " (type " << dec << entry.type() << "): " << hex << single << " vs. " << batch << " vs. " << parallel << " vs. " << ordered << " vs. " << replayed << dec << endl;
+				return false;
+			}
+		}
+	return true;
+}
+
+/*! \brief Resolve the undefined dynamic symbols of the ELF file in a scope of itself and its additional objects */
+template<ELFCLASS C>
+static bool bench_scope(const ELF<C> & elf, const Vector<void *> & objects, size_t rounds) {
+	const auto dyn = elf.dynamic();
+	if (dyn.empty())
+		return true;
+
+	// ELF objects and version tables must outlive the scope objects (hence reserve memory in advance)
+	Vector<ELF<C>> elfs;
+	elfs.reserve(objects.size());
+	Vector<Vector<typename VersionTable<C>::Entry>> version_buffers;
+	version_buffers.reserve(objects.size() + 1);
+	Vector<typename ResolutionScope<C>::Object> scope_objects;
+	version_buffers.emplace_back(ResolutionScope<C>::Object::entries(dyn));
+	scope_objects.emplace_back(elf, version_buffers.back().data(), version_buffers.back().size());
+	for (void * addr : objects) {
+		ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(addr);
+		if (ident->elfclass() != C) {
+			cerr << "Scope object has different ELF class -- skipping!" << endl;
+			continue;
+		}
+		elfs.emplace_back(reinterpret_cast<uintptr_t>(addr));
+		if (elfs.back().dynamic().empty()) {
+			cerr << "Scope object has no dynamic section -- skipping!" << endl;
+			continue;
+		}
+		version_buffers.emplace_back(ResolutionScope<C>::Object::entries(elfs.back().dynamic()));
+		scope_objects.emplace_back(elfs.back(), version_buffers.back().data(), version_buffers.back().size());
+	}
+	ResolutionScope<C> scope(scope_objects.data(), scope_objects.size());
+
+	// Queries for all undefined symbols
+	Vector<typename ResolutionScope<C>::Query> queries;
+	for (const auto & sym : dyn.get_symbols())
+		if (sym.valid() && sym.undefined() && sym.name()[0] != '\0')
+			queries.emplace_back(sym.name());
+	if (queries.empty())
+		return true;
+	Vector<typename ResolutionScope<C>::Result> single(queries.size());
+	Vector<typename ResolutionScope<C>::Result> batch(queries.size());
+
+	cout << "Symbol resolution (" << queries.size() << " undefined symbols, " << scope.count << " objects in scope, " << rounds << " rounds):" << endl;
+
+	// Naive: hash the name for each object in scope, no bloom filter rejection and no checks
+	uint64_t start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < queries.size(); i++)
+			for (size_t o = 0; o < scope.count; o++)
+				if ((single[i].index = static_cast<uint32_t>(scope.objects[o].symbols.index(queries[i].key.name))) != ELF<C>::STN_UNDEF)
+					break;
+	report("index() [naive]", now() - start, rounds * queries.size());
+
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < queries.size(); i++)
+			single[i] = scope.resolve(queries[i]);
+	report("resolve()      ", now() - start, rounds * queries.size());
+
+	size_t resolved = 0;
+	start = now();
+	for (size_t r = 0; r < rounds; r++)
+		resolved = scope.resolve_many(queries.data(), queries.size(), batch.data());
+	report("resolve_many() ", now() - start, rounds * queries.size());
+	cout << "  (" << resolved << " resolved)" << endl;
+
+	for (size_t i = 0; i < queries.size(); i++)
+		if (single[i].object != batch[i].object || single[i].index != batch[i].index) {
+			cerr << "Resolution mismatch for '" << queries[i].key.name << "'" << endl;
+			return false;
+		}
+
+	// Lookup statistics without and with negative cache
+	const size_t cache_slots = 1024;
+	Vector<uint64_t> cache(scope_objects.size() * cache_slots);
+	for (int use_cache = 0; use_cache <= 1; use_cache++) {
+		typename ELF<C>::SymbolTable::Statistics statistics = {};
+		for (size_t o = 0; o < scope_objects.size(); o++) {
+			scope_objects[o].symbols.set_statistics(&statistics);
+			scope_objects[o].symbols.set_negative_cache(use_cache == 1 ? cache.data() + o * cache_slots : nullptr, cache_slots);
+		}
+
+		start = now();
+		for (size_t r = 0; r < rounds; r++)
+			for (size_t i = 0; i < queries.size(); i++)
+				batch[i] = scope.resolve(queries[i]);
+		const uint64_t duration = now() - start;
+
+		for (size_t i = 0; i < queries.size(); i++)
+			if (single[i].object != batch[i].object || single[i].index != batch[i].index) {
+				cerr << "Resolution mismatch for '" << queries[i].key.name << "' (negative cache)" << endl;
+				return false;
+			}
+
+		report(use_cache == 1 ? "resolve() [cache]  " : "resolve() [counted]", duration, rounds * queries.size());
+		cout << "    " << statistics.lookups << " lookups, "
+		     << statistics.bloom_rejections << " bloom rejections, "
+		     << statistics.cache_hits << " cache hits, "
+		     << statistics.cache_inserts << " cache inserts, "
+		     << statistics.bucket_empty << " empty buckets, "
+		     << statistics.chain_steps << " chain steps, "
+		     << statistics.strcmp_calls << " strcmp calls" << endl;
+	}
+	for (auto & object : scope_objects) {
+		object.symbols.set_statistics(nullptr);
+		object.symbols.set_negative_cache(nullptr, 0);
+	}
+
+	// Lazy binding of the procedure linkage table: setup and resolution of each slot on first call
+	using Binding = LazyBinding<C>;
+	Vector<typename Binding::Slot> slots(Binding::slots(dyn));
+	if (slots.empty())
+		return true;
+	Vector<typename VersionTable<C>::Entry> version_entries(VersionTable<C>::entries(dyn));
+	const VersionTable<C> versions(dyn, version_entries.data(), version_entries.size());
+	Vector<uint8_t> image(image_size(elf));
+	const uintptr_t base = reinterpret_cast<uintptr_t>(image.data());
+	auto resolve = [&scope](uint32_t, const typename Binding::Query & query) -> uintptr_t {
+		const auto result = scope.resolve(query);
+		return result.found() ? scope.symbol(result).value() : 0;
+	};
+	size_t lazy = 0;
+	uint64_t setup = 0;
+	uint64_t binding = 0;
+	for (size_t r = 0; r < rounds; r++) {
+		load_image(elf, image);
+		start = now();
+		const Binding plt(elf, base, slots.data(), slots.size(), &versions);
+		lazy = plt.prepare(0, 0);
+		setup += now() - start;
+		start = now();
+		for (size_t i = 0; i < plt.count(); i++)
+			if (plt.slot(i).symbol_index != ELF<C>::STN_UNDEF)
+				plt.resolve_plt_slot(i, resolve);
+		binding += now() - start;
+	}
+	cout << "Lazy binding (" << lazy << " of " << slots.size() << " PLT slots, " << rounds << " rounds):" << endl;
+	report("LazyBinding [setup]", setup, rounds * slots.size());
+	report("resolve_plt_slot() ", binding, rounds * lazy);
+
+	const auto versioned = dyn.get_symbol_table();
+	for (size_t i = 0; i < slots.size(); i++) {
+		const auto & slot = slots[i];
+		if (slot.symbol_index == ELF<C>::STN_UNDEF)
+			continue;
+		const auto symbol = dyn.get_symbols()[slot.symbol_index];
+		const auto result = scope.resolve(typename ResolutionScope<C>::Query(symbol.name(), versions.name(versioned.version(slot.symbol_index))));
+		const auto value = *reinterpret_cast<typename ELF_Def::Structures<C>::Elf_Addr *>(base + slot.offset);
+		if (result.found() && value != scope.symbol(result).value()) {
+			cerr << "Lazy binding mismatch for '" << symbol.name() << "'" << endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+/*! \brief Cost of the validation and of checked vs. verified (unchecked) accessors */
+template<ELFCLASS C>
+static bool bench_verify(const ELF<C> & elf, size_t length, size_t rounds) {
+	const uint64_t start_validate = now();
+	Validator<C> validator(elf, length);
+	validator.validate();
+	const uint64_t validate = now() - start_validate;
+	const auto * verified = validator.verified();
+	if (verified == nullptr) {
+		cout << "Validation failed (error " << validator.error() << ")" << endl;
+		return true;
+	}
+	const auto & checked = validator.checked();
+
+	for (const auto & section : elf.sections) {
+		if (section.type() != ELF<C>::SHT_DYNSYM && section.type() != ELF<C>::SHT_SYMTAB)
+			continue;
+		const uint16_t index = static_cast<uint16_t>(elf.sections.index(section));
+		const uint32_t symbols = static_cast<uint32_t>(section.entries());
+		cout << "Symbol names in '" << section.name() << "' (" << symbols << " symbols, " << rounds << " rounds):" << endl;
+		report("validate()   ", validate, 1);
+
+		uint64_t start = now();
+		size_t checksum = 0;
+		for (size_t r = 0; r < rounds; r++)
+			for (uint32_t i = 0; i < symbols; i++)
+				checksum += reinterpret_cast<uintptr_t>(checked.symbol_name(index, i));
+		report("Checked      ", now() - start, rounds * symbols);
+
+		start = now();
+		size_t checksum_verified = 0;
+		for (size_t r = 0; r < rounds; r++)
+			for (uint32_t i = 0; i < symbols; i++)
+				checksum_verified += reinterpret_cast<uintptr_t>(verified->symbol_name(index, i));
+		report("Verified     ", now() - start, rounds * symbols);
+
+		if (checksum != checksum_verified) {
+			cerr << "Checked and verified symbol names differ" << endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+template<ELFCLASS C>
+static bool bench(void * addr, size_t length, const Vector<void *> & objects, size_t rounds) {
+	ELF<C> elf(reinterpret_cast<uintptr_t>(addr));
+	if (!elf.valid(length)) {
+		cerr << "No valid ELF file!" << endl;
+		return false;
+	}
+
+	return bench_dynamic(elf, rounds)
+	    && bench_sections(elf, rounds)
+	    && bench_hash(elf, rounds)
+	    && bench_lookup(elf, rounds)
+	    && bench_symtab(elf, rounds)
+	    && bench_address(elf, rounds)
+	    && bench_relocation(elf, rounds)
+	    && bench_relr(elf, rounds)
+	    && bench_scope(elf, objects, rounds)
+	    && bench_verify(elf, length, rounds);
+}
+
+static bool bench(void * addr, size_t length, const Vector<void *> & objects, size_t rounds) {
+	// Read ELF Identification
+	ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(addr);
+	if (length < sizeof(ELF_Ident) || !ident->valid()) {
+		cerr << "No valid ELF identification header!" << endl;
+		return false;
+	} else if (!ident->data_supported()) {
+		cerr << "Unsupported encoding!" << endl;
+		return false;
+	} else {
+		switch (ident->elfclass()) {
+			case ELFCLASS::ELFCLASS32:
+				return bench<ELFCLASS::ELFCLASS32>(addr, length, objects, rounds);
+
+			case ELFCLASS::ELFCLASS64:
+				return bench<ELFCLASS::ELFCLASS64>(addr, length, objects, rounds);
+
+			default:
+				cerr << "Unsupported class!" << endl;
+				return false;
+		}
+	}
+}
+
+/*! \brief Map file (read only)
+ * \param path file path
+ * \param length reference to store the file size
+ * \return address of mapped file or `nullptr` on error
+ */
+static void * map(const char * path, size_t & length) {
+	// Open file
+	int fd = ::open(path, O_RDONLY);
+	if (fd == -1) {
+		::perror("open");
+		return nullptr;
+	}
+
+	// Determine file size
+	struct stat sb;
+	if (::fstat(fd, &sb) == -1) {
+		::perror("fstat");
+		::close(fd);
+		return nullptr;
+	}
+	length = sb.st_size;
+
+	// Map file
+	void * addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (addr == MAP_FAILED) {
+		::perror("mmap");
+		return nullptr;
+	}
+	return addr;
+}
+
+int main(int argc, char *argv[]) {
+	// Check arguments
+	if (argc < 2) {
+		cerr << "Usage: " << argv[0] << " ELF-FILE [ROUNDS [SCOPE-OBJECT...]]" << endl;
+		return EXIT_FAILURE;
+	}
+	size_t rounds = argc >= 3 ? strtoul(argv[2], nullptr, 0) : 100;
+
+	size_t length;
+	void * addr = map(argv[1], length);
+	if (addr == nullptr)
+		return EXIT_FAILURE;
+
+	// Additional objects for symbol resolution scope
+	Vector<void *> objects;
+	Vector<size_t> lengths;
+	for (int i = 3; i < argc; i++) {
+		size_t object_length;
+		void * object = map(argv[i], object_length);
+		ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(object);
+		if (object == nullptr || object_length < sizeof(ELF_Ident) || !ident->valid() || !ident->data_supported()) {
+			cerr << "Invalid scope object " << argv[i] << " -- skipping!" << endl;
+			if (object != nullptr)
+				::munmap(object, object_length);
+		} else {
+			objects.push_back(object);
+			lengths.push_back(object_length);
+		}
+	}
+
+	// Run benchmarks
+	bool success = bench(addr, length, objects, rounds);
+
+	// Cleanup
+	for (size_t i = 0; i < objects.size(); i++)
+		::munmap(objects[i], lengths[i]);
+	::munmap(addr, length);
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,168 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstdlib>
+#ifdef USE_DLH
+#include <dlh/container/vector.hpp>
+#include <dlh/stream/output.hpp>
+#else
+#include <iostream>
+#include <vector>
+template<class T>
+using Vector = std::vector<T, std::allocator<T>>;
+using std::cerr;
+using std::cout;
+using std::endl;
+#endif
+
+#include <elfo/elf.hpp>
+#include <elfo/elf_dirty.hpp>
+
+template<ELFCLASS C>
+static bool dirty(void * addr, size_t length, size_t page_size) {
+	ELF<C> elf(reinterpret_cast<uintptr_t>(addr));
+	if (!elf.valid(length)) {
+		cerr << "No valid ELF file!" << endl;
+		return false;
+	}
+	switch (elf.header.machine()) {
+		case ELF_Def::Constants::EM_386:
+		case ELF_Def::Constants::EM_486:
+		case ELF_Def::Constants::EM_X86_64:
+			break;
+		default:
+			cerr << "Unsupported machine!" << endl;
+			return false;
+	}
+	const auto dynamic = elf.dynamic();
+	if (dynamic.empty()) {
+		cerr << "No dynamic section in ELF file!" << endl;
+		return false;
+	}
+
+	using Analysis = DirtyPages<C>;
+	Vector<typename Analysis::Segment> segments(Analysis::segments(elf));
+	Vector<uint64_t> bitmap(Analysis::bitmap_size(elf, page_size));
+	Analysis analysis(elf, segments.data(), segments.size(), bitmap.data(), bitmap.size(), page_size);
+
+	// Dirty pages per loadable segment
+	cout << "Pages dirtied by relocations (page size " << page_size << "):" << endl
+	     << "  Segment               Pages  Relative (relocs)    Symbol (relocs)       PLT (relocs)    Total" << endl;
+	size_t pages = 0;
+	size_t total = 0;
+	for (size_t i = 0; i < analysis.count(); i++) {
+		const auto & s = analysis.segment(i);
+		pages += s.pages;
+		total += s.dirty_total;
+		if (s.dirty_total == 0)
+			continue;
+		char line[160];
+		snprintf(line, sizeof(line), "  0x%08lx+0x%-8lx %6zu  %8zu (%6zu)  %8zu (%6zu)  %8zu (%6zu)  %6zu",
+		         static_cast<unsigned long>(s.virt_addr), static_cast<unsigned long>(s.virt_size), s.pages,
+		         s.dirty[Analysis::RELATIVE], s.relocations[Analysis::RELATIVE],
+		         s.dirty[Analysis::SYMBOL], s.relocations[Analysis::SYMBOL],
+		         s.dirty[Analysis::PLT], s.relocations[Analysis::PLT], s.dirty_total);
+		cout << line << endl;
+	}
+	cout << "  " << total << " of " << pages << " pages dirtied" << endl << endl;
+
+	// Symbols dirtying pages without relative relocations
+	cout << "Symbol relocations on pages without relative relocations:" << endl;
+	auto report = [&](const typename ELF<C>::Relocation & entry, bool exclusive) {
+		if (exclusive) {
+			char line[32];
+			snprintf(line, sizeof(line), "  0x%08lx ", static_cast<unsigned long>(entry.offset()));
+			cout << line << dynamic.get_symbols()[entry.symbol_index()].name() << endl;
+		}
+	};
+	const size_t exclusive = analysis.symbols(dynamic.get_relocations(), report)
+	                       + analysis.symbols(dynamic.get_relocations_plt(), report);
+	cout << "  " << exclusive << " relocations" << endl << endl;
+
+	// Relocations (excluding PLT) grouped by target page, as applied in page order
+	cout << "Relocations in page order:" << endl;
+	const auto relocations = dynamic.get_relocations();
+	Vector<uint32_t> order(relocations.count());
+	Analysis::page_order(relocations, order.data());
+	for (size_t i = 0; i < order.size();) {
+		const uintptr_t page = relocations[order[i]].offset() / page_size;
+		size_t n = 0;
+		for (; i < order.size() && relocations[order[i]].offset() / page_size == page; i++)
+			n++;
+		char line[48];
+		snprintf(line, sizeof(line), "  0x%08lx %6zu relocations", static_cast<unsigned long>(page * page_size), n);
+		cout << line << endl;
+	}
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	// Check arguments
+	if (argc != 2 && argc != 3) {
+		cerr << "Usage: " << argv[0] << " ELF-FILE [PAGE-SIZE]" << endl;
+		return EXIT_FAILURE;
+	}
+	const size_t page_size = argc == 3 ? strtoul(argv[2], nullptr, 0) : 4096;
+	if (page_size == 0) {
+		cerr << "Invalid page size!" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Open file
+	int fd = ::open(argv[1], O_RDONLY);
+	if (fd == -1) {
+		::perror("open");
+		return EXIT_FAILURE;
+	}
+
+	// Determine file size
+	struct stat sb;
+	if (::fstat(fd, &sb) == -1) {
+		::perror("fstat");
+		::close(fd);
+		return EXIT_FAILURE;
+	}
+	size_t length = sb.st_size;
+
+	// Map file
+	void * addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (addr == MAP_FAILED) {
+		::perror("mmap");
+		::close(fd);
+		return EXIT_FAILURE;
+	}
+
+	// Analyze relocations
+	bool success = false;
+	ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(addr);
+	if (length < sizeof(ELF_Ident) || !ident->valid()) {
+		cerr << "No valid ELF identification header!" << endl;
+	} else if (!ident->data_supported()) {
+		cerr << "Unsupported encoding (must be " << ELF_Ident::data_host() << ")!" << endl;
+	} else {
+		switch (ident->elfclass()) {
+			case ELFCLASS::ELFCLASS32:
+				success = dirty<ELFCLASS::ELFCLASS32>(addr, length, page_size);
+				break;
+
+			case ELFCLASS::ELFCLASS64:
+				success = dirty<ELFCLASS::ELFCLASS64>(addr, length, page_size);
+				break;
+
+			default:
+				cerr << "Unsupported class '" << ident->elfclass() << "'" << endl;
+				success = false;
+		}
+	}
+
+	// Cleanup
+	::munmap(addr, length);
+	::close(fd);
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
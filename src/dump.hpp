@@ -555,6 +555,12 @@ class Dump {
 					relocations(rel);
 				}
 
+				auto relr = dyn.get_relative_relocations();
+				if (!relr.empty()) {
+					cout << "Relative relocation table contains " << DEC() << relr.count() << " entries:" << endl;
+					relocations(relr);
+				}
+
 				auto relplt = dyn.get_relocations_plt();
 				if (!relplt.empty()) {
 					cout << "PLT relocation table contains " << DEC() << relplt.count() << " entries:" << endl;
@@ -11,6 +11,7 @@
 #endif
 
 #include <elfo/elf.hpp>
+#include <elfo/elf_version.hpp>
 
 template<ELFCLASS C>
 class ELF_Dyn : public ELF<C> {
@@ -35,6 +36,11 @@ class ELF_Dyn : public ELF<C> {
 	List<VersionNeeded> version_needed;
 	List<VersionDefinition> version_definition;
 
+	/*! \brief Maximum number of versions in the version table (otherwise the lists are searched) */
+	static const size_t version_entries = 256;
+	typename VersionTable<C>::Entry version_entry[version_entries];
+	VersionTable<C> version_table;
+
 	explicit ELF_Dyn(uintptr_t start)
 	  : ELF<C>(start),
 	    dyn(this->dynamic()),
@@ -42,9 +48,13 @@ class ELF_Dyn : public ELF<C> {
 	    relocations(dyn.get_relocations()),
 	    relocations_plt(dyn.get_relocations_plt()),
 	    version_needed(dyn.get_version_needed()),
-	    version_definition(dyn.get_version_definition()) {}
+	    version_definition(dyn.get_version_definition()),
+	    version_table(version_needed, version_definition, version_entry, version_entries) {}
 
 	uint16_t version_index(const char * name) const {
+		if (version_table.complete())
+			return version_table.index(name);
+
 		for (auto & v : version_needed)
 			for (auto & aux : v.auxiliary())
 				if (strcmp(name, aux.name()) == 0)
@@ -66,6 +76,11 @@ class ELF_Dyn : public ELF<C> {
 			case Def::VER_NDX_ELIMINATE:
 				return "*eliminate*";
 		}
+		if (version_table.complete()) {
+			const char * name = version_table.name(index);
+			return name == nullptr ? "*invalid*" : name;
+		}
+
 		for (auto & v : version_needed)
 			for (auto & aux : v.auxiliary())
 				if (index == aux.version_index())
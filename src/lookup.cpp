@@ -126,10 +126,11 @@ static  bool elflookup(void * addr, size_t length, const Vector<char*> & symbols
 				elfsymbol(elf, symbol);
 		cout << "(" << elf.symbols.count() << " dynamic symbols in file)" << endl;
 	} else {
-		size_t found = 0;
+		Vector<const char *> names;
+		Vector<uint16_t> versions;
 		for (char * name : symbols) {
 			// Check version
-			uint32_t version = ELF_Dyn<C>::VER_NDX_GLOBAL;
+			uint16_t version = ELF_Dyn<C>::VER_NDX_GLOBAL;
 			char * version_name = strrchr(name, '@');
 			if (version_name != nullptr) {
 				// Replace '@' by end delimiter
@@ -142,14 +143,21 @@ static  bool elflookup(void * addr, size_t length, const Vector<char*> & symbols
 					continue;
 				}
 			}
+			names.push_back(name);
+			versions.push_back(version);
+		}
 
-			// Find symbol
-			auto idx = elf.symbols.index(name, version);
-			if (idx != ELF_Dyn<C>::STN_UNDEF) {
-				elfsymbol(elf, elf.symbols.at(idx));
+		// Find all symbols at once
+		Vector<uint32_t> results(names.size());
+		elf.symbols.index_many(names.data(), names.size(), results.data(), versions.data());
+
+		size_t found = 0;
+		for (size_t i = 0; i < names.size(); i++) {
+			if (results[i] != ELF_Dyn<C>::STN_UNDEF) {
+				elfsymbol(elf, elf.symbols.at(results[i]));
 				found++;
 			} else {
-				cerr << "Symbol '" << name << "' not found!" << endl;
+				cerr << "Symbol '" << names[i] << "' not found!" << endl;
 				success = false;
 			}
 		}
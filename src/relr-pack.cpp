@@ -0,0 +1,344 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#ifdef USE_DLH
+#include <dlh/container/vector.hpp>
+#include <dlh/stream/output.hpp>
+#else
+#include <iostream>
+#include <vector>
+template<class T>
+using Vector = std::vector<T, std::allocator<T>>;
+using std::cerr;
+using std::cout;
+using std::endl;
+#endif
+
+#include <elfo/elf.hpp>
+#include <elfo/elf_def/sort.hpp>
+
+/*! \brief Relative relocation to be packed */
+struct Relative {
+	/*! \brief Virtual address of target word */
+	uintptr_t offset;
+	/*! \brief Index in relocation table */
+	size_t index;
+};
+
+/*! \brief Get pointer to file contents of a word at a virtual address
+ * \param elf ELF file
+ * \param vaddr virtual address
+ * \param size size of word
+ * \return pointer to the word or `nullptr` if it is not (completely) backed by the file
+ */
+template<ELFCLASS C>
+static void * file_word(const ELF<C> & elf, uintptr_t vaddr, size_t size) {
+	for (const auto & s : elf.segments)
+		if (s.type() == ELF_Def::Constants::PT_LOAD && vaddr >= s.virt_addr() && vaddr + size <= s.virt_addr() + s.size())
+			return elf.data(s.offset() + vaddr - s.virt_addr());
+	return nullptr;
+}
+
+template<ELFCLASS C>
+static bool relrpack(void * addr, size_t length, bool force) {
+	using Def = ELF_Def::Structures<C>;
+	using Word = typename Def::Elf_Addr;
+
+	ELF<C> elf(reinterpret_cast<uintptr_t>(addr));
+	if (!elf.valid(length)) {
+		cerr << "No valid ELF file!" << endl;
+		return false;
+	}
+
+	// Relative relocation type
+	uint32_t relative;
+	switch (elf.header.machine()) {
+		case ELF_Def::Constants::EM_386:
+		case ELF_Def::Constants::EM_486:
+			relative = ELF_Def::Constants::R_386_RELATIVE;
+			break;
+		case ELF_Def::Constants::EM_X86_64:
+			relative = ELF_Def::Constants::R_X86_64_RELATIVE;
+			break;
+		default:
+			cerr << "Unsupported machine!" << endl;
+			return false;
+	}
+
+	// Raw dynamic section (including spare entries after the terminating DT_NULL)
+	typename Def::Dyn * dyn = nullptr;
+	size_t dyn_entries = 0;
+	for (const auto & s : elf.segments)
+		if (s.type() == ELF_Def::Constants::PT_DYNAMIC) {
+			dyn = reinterpret_cast<typename Def::Dyn *>(s.data());
+			dyn_entries = s.size() / sizeof(typename Def::Dyn);
+		}
+	if (dyn == nullptr) {
+		cerr << "No dynamic section in ELF file!" << endl;
+		return false;
+	}
+
+	typename Def::Dyn * dyn_size = nullptr;
+	typename Def::Dyn * dyn_count = nullptr;
+	uintptr_t rel_vaddr = 0;
+	uintptr_t jmprel_vaddr = 0;
+	size_t dyn_used = dyn_entries;
+	for (size_t i = 0; i < dyn_entries; i++) {
+		switch (dyn[i].d_tag) {
+			case ELF_Def::Constants::DT_RELR:
+			case ELF_Def::Constants::DT_RELRSZ:
+				cerr << "ELF file already contains relative relocations (DT_RELR)!" << endl;
+				return false;
+			case ELF_Def::Constants::DT_REL:
+			case ELF_Def::Constants::DT_RELA:
+				rel_vaddr = dyn[i].d_un.d_ptr;
+				break;
+			case ELF_Def::Constants::DT_RELSZ:
+			case ELF_Def::Constants::DT_RELASZ:
+				dyn_size = dyn + i;
+				break;
+			case ELF_Def::Constants::DT_RELCOUNT:
+			case ELF_Def::Constants::DT_RELACOUNT:
+				dyn_count = dyn + i;
+				break;
+			case ELF_Def::Constants::DT_JMPREL:
+				jmprel_vaddr = dyn[i].d_un.d_ptr;
+				break;
+		}
+		if (dyn[i].d_tag == ELF_Def::Constants::DT_NULL) {
+			dyn_used = i + 1;
+			break;
+		}
+	}
+
+	const auto dynamic = elf.dynamic();
+	const auto relocations = dynamic.get_relocations();
+	if (relocations.empty() || dyn_size == nullptr) {
+		cout << "No relocations in ELF file." << endl;
+		return true;
+	} else if (jmprel_vaddr >= rel_vaddr && jmprel_vaddr < rel_vaddr + dyn_size->d_un.d_val) {
+		cerr << "Procedure linkage table relocations are part of the relocation table!" << endl;
+		return false;
+	}
+
+	// Collect relative relocations with targets in the file
+	const size_t entsize = relocations.accessor().element_size();
+	Vector<Relative> relatives;
+	for (size_t i = 0; i < relocations.count(); i++) {
+		const auto & r = relocations[i];
+		if (r.type() == relative && r.offset() % 2 == 0 && file_word(elf, r.offset(), sizeof(Word)) != nullptr)
+			relatives.push_back({ r.offset(), i });
+	}
+	if (relatives.size() == 0) {
+		cout << "No relative relocations to pack." << endl;
+		return true;
+	}
+	ELF_Def::sort(relatives.data(), relatives.size(), [](const Relative & a, const Relative & b) { return a.offset < b.offset; });
+
+	// Duplicate targets are kept in the relocation table
+	Vector<uintptr_t> offsets;
+	for (size_t i = 0; i < relatives.size(); i++)
+		if (i + 1 < relatives.size() && relatives[i].offset == relatives[i + 1].offset)
+			relatives[i + 1].index = relatives[i].index = relocations.count();
+		else if (relatives[i].index < relocations.count())
+			offsets.push_back(relatives[i].offset);
+
+	// Check space in relocation and dynamic table before modifying anything
+	const size_t kept = relocations.count() - offsets.size();
+	const size_t relr_offset = kept * entsize;
+	const size_t relr_entries = ELF_Def::relr_encode<Word>(offsets.data(), offsets.size());
+	if (relr_offset + relr_entries * sizeof(Word) > relocations.count() * entsize) {
+		cerr << "Not enough space for " << relr_entries << " packed entries!" << endl;
+		return false;
+	}
+	const size_t dyn_required = 3 - (dyn_count != nullptr ? 1 : 0);
+	if (dyn_entries - dyn_used < dyn_required) {
+		cerr << "Not enough spare entries in dynamic section (" << (dyn_entries - dyn_used) << ", but need " << dyn_required << ")!" << endl;
+		return false;
+	}
+
+	// The GNU libc requires a version dependency for DT_RELR
+	bool relr_version = false;
+	for (const auto & v : dynamic.get_version_needed())
+		for (const auto & aux : v.auxiliary())
+			if (strcmp(aux.name(), "GLIBC_ABI_DT_RELR") == 0)
+				relr_version = true;
+	if (!relr_version) {
+		if (!force) {
+			cerr << "No version dependency on GLIBC_ABI_DT_RELR (required by GNU libc) -- use -f to pack anyway!" << endl;
+			return false;
+		}
+		cerr << "Warning: No version dependency on GLIBC_ABI_DT_RELR (required by GNU libc)!" << endl;
+	}
+
+	// Mark packed entries and apply RELA addends to target words (for REL, they are already in place)
+	Vector<bool> packed(relocations.count(), false);
+	for (const auto & r : relatives)
+		if (r.index < relocations.count()) {
+			packed[r.index] = true;
+			if (relocations.accessor().withAddend)
+				*reinterpret_cast<Word *>(file_word(elf, r.offset, sizeof(Word))) = static_cast<Word>(relocations[r.index].addend());
+		}
+
+	// Compact remaining relocations
+	uint8_t * table = reinterpret_cast<uint8_t *>(relocations.address());
+	size_t n = 0;
+	for (size_t i = 0; i < relocations.count(); i++)
+		if (!packed[i]) {
+			if (n != i)
+				memmove(table + n * entsize, table + i * entsize, entsize);
+			n++;
+		}
+
+	// Append packed relocations
+	Word * relr = reinterpret_cast<Word *>(table + relr_offset);
+	ELF_Def::relr_encode<Word>(offsets.data(), offsets.size(), relr, relr_entries);
+	memset(relr + relr_entries, 0, relocations.count() * entsize - relr_offset - relr_entries * sizeof(Word));
+
+	// Adjust section header
+	const uintptr_t table_offset = reinterpret_cast<uintptr_t>(table) - reinterpret_cast<uintptr_t>(addr);
+	for (const auto & s : elf.sections)
+		if ((s.type() == ELF_Def::Constants::SHT_REL || s.type() == ELF_Def::Constants::SHT_RELA) && s.offset() == table_offset)
+			const_cast<typename Def::Shdr *>(s.ptr())->sh_size = relr_offset;
+
+	// Adjust dynamic section
+	dyn_size->d_un.d_val = relr_offset;
+	typename Def::Dyn * spare = dyn + dyn_used - 1;  // terminating DT_NULL
+	if (dyn_count == nullptr)
+		dyn_count = spare++;
+	dyn_count->d_tag = ELF_Def::Constants::DT_RELR;
+	dyn_count->d_un.d_ptr = rel_vaddr + relr_offset;
+	spare->d_tag = ELF_Def::Constants::DT_RELRSZ;
+	(spare++)->d_un.d_val = relr_entries * sizeof(Word);
+	spare->d_tag = ELF_Def::Constants::DT_RELRENT;
+	(spare++)->d_un.d_val = sizeof(Word);
+	spare->d_tag = ELF_Def::Constants::DT_NULL;
+	spare->d_un.d_val = 0;
+
+	cout << "Packed " << offsets.size() << " relative relocations into " << relr_entries << " entries (" << n << " relocations remaining)" << endl;
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	// Check arguments
+	const bool force = argc > 1 && strcmp(argv[1], "-f") == 0;
+	if (force) {
+		argv++;
+		argc--;
+	}
+	if (argc != 2 && argc != 3) {
+		cerr << "Usage: " << argv[0] << " [-f] ELF-FILE [OUTPUT]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	// Open file
+	int fd = ::open(argv[1], argc == 3 ? O_RDONLY : O_RDWR);
+	if (fd == -1) {
+		::perror("open");
+		return EXIT_FAILURE;
+	}
+
+	// Determine file size
+	struct stat sb;
+	if (::fstat(fd, &sb) == -1) {
+		::perror("fstat");
+		::close(fd);
+		return EXIT_FAILURE;
+	}
+	size_t length = sb.st_size;
+
+	// Copy to a temporary file next to the output, which replaces the output only on success
+	// (hence the input is never truncated, even if the output is the same file or a link to it)
+	const char suffix[] = ".XXXXXX";
+	const size_t output_length = argc == 3 ? strlen(argv[2]) : 0;
+	Vector<char> temp(output_length + sizeof(suffix));
+	if (argc == 3) {
+		memcpy(temp.data(), argv[2], output_length);
+		memcpy(temp.data() + output_length, suffix, sizeof(suffix));
+		int out = ::mkstemp(temp.data());
+		if (out == -1) {
+			::perror("mkstemp");
+			::close(fd);
+			return EXIT_FAILURE;
+		}
+		if (::fchmod(out, sb.st_mode & 07777) == -1) {
+			::perror("fchmod");
+			::close(out);
+			::unlink(temp.data());
+			::close(fd);
+			return EXIT_FAILURE;
+		}
+		char buf[4096];
+		ssize_t r;
+		while ((r = ::read(fd, buf, sizeof(buf))) > 0)
+			if (::write(out, buf, r) != r) {
+				r = -1;
+				break;
+			}
+		::close(fd);
+		if (r == -1) {
+			::perror("copy");
+			::close(out);
+			::unlink(temp.data());
+			return EXIT_FAILURE;
+		}
+		fd = out;
+	}
+
+	// Map file
+	void * addr = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (addr == MAP_FAILED) {
+		::perror("mmap");
+		::close(fd);
+		if (argc == 3)
+			::unlink(temp.data());
+		return EXIT_FAILURE;
+	}
+
+	// Pack relocations
+	bool success = false;
+	ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(addr);
+	if (length < sizeof(ELF_Ident) || !ident->valid()) {
+		cerr << "No valid ELF identification header!" << endl;
+	} else if (!ident->data_supported()) {
+		cerr << "Unsupported encoding (must be " << ELF_Ident::data_host() << ")!" << endl;
+	} else {
+		switch (ident->elfclass()) {
+			case ELFCLASS::ELFCLASS32:
+				success = relrpack<ELFCLASS::ELFCLASS32>(addr, length, force);
+				break;
+
+			case ELFCLASS::ELFCLASS64:
+				success = relrpack<ELFCLASS::ELFCLASS64>(addr, length, force);
+				break;
+
+			default:
+				cerr << "Unsupported class '" << ident->elfclass() << "'" << endl;
+				success = false;
+		}
+	}
+
+	// Cleanup
+	::munmap(addr, length);
+	::close(fd);
+
+	// Replace output
+	if (argc == 3) {
+		if (!success) {
+			::unlink(temp.data());
+		} else if (::rename(temp.data(), argv[2]) == -1) {
+			::perror("rename");
+			::unlink(temp.data());
+			success = false;
+		}
+	}
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
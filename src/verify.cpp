@@ -0,0 +1,119 @@
+// Elfo - a lightweight parser for the Executable and Linking Format
+// Copyright 2021-2023 by Bernhard Heinloth <heinloth@cs.fau.de>
+// SPDX-License-Identifier: AGPL-3.0-or-later
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstdlib>
+#ifdef USE_DLH
+#include <dlh/stream/output.hpp>
+#else
+#include <iostream>
+using std::cerr;
+using std::cout;
+using std::endl;
+#endif
+
+#include <elfo/elf.hpp>
+#include <elfo/elf_verify.hpp>
+
+static const char * const errors[] = {
+	"valid",
+	"not validated",
+	"headers, segments or sections exceed the file",
+	"invalid section names",
+	"invalid section link",
+	"unterminated string table",
+	"invalid symbol table",
+	"invalid hash table",
+	"invalid GNU hash table",
+	"invalid relocation",
+	"invalid relative relocation",
+	"invalid version table",
+	"invalid note",
+	"invalid dynamic table"
+};
+
+template<ELFCLASS C>
+static bool verify(const char * path, void * addr, size_t length) {
+	ELF<C> elf(reinterpret_cast<uintptr_t>(addr));
+	Validator<C> validator(elf, length);
+	const auto result = validator.validate();
+	cout << path << ": " << errors[result];
+	if (result != Validator<C>::NONE && validator.section() != ELF_Def::Constants::SHN_UNDEF) {
+		// The section header (string table) might be the culprit as well, hence only use checked accessors
+		const char * name = validator.checked().section_name(validator.section());
+		cout << " in section " << validator.section() << " (" << (name == nullptr ? "unnamed" : name) << ")";
+	}
+	cout << endl;
+	return result == Validator<C>::NONE;
+}
+
+int main(int argc, char *argv[]) {
+	// Check arguments
+	if (argc < 2) {
+		cerr << "Usage: " << argv[0] << " ELF-FILE[S]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	bool success = true;
+	for (int i = 1; i < argc; i++) {
+		// Open file
+		int fd = ::open(argv[i], O_RDONLY);
+		if (fd == -1) {
+			::perror("open");
+			success = false;
+			continue;
+		}
+
+		// Determine file size
+		struct stat sb;
+		if (::fstat(fd, &sb) == -1) {
+			::perror("fstat");
+			::close(fd);
+			success = false;
+			continue;
+		}
+		size_t length = sb.st_size;
+
+		// Map file
+		void * addr = length == 0 ? MAP_FAILED : ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr == MAP_FAILED) {
+			cerr << argv[i] << ": cannot map file" << endl;
+			::close(fd);
+			success = false;
+			continue;
+		}
+
+		// Validate
+		ELF_Ident * ident = reinterpret_cast<ELF_Ident *>(addr);
+		if (length < sizeof(ELF_Ident) || !ident->valid()) {
+			cerr << argv[i] << ": no valid ELF identification header" << endl;
+			success = false;
+		} else if (!ident->data_supported()) {
+			cerr << argv[i] << ": unsupported encoding" << endl;
+			success = false;
+		} else {
+			switch (ident->elfclass()) {
+				case ELFCLASS::ELFCLASS32:
+					success &= verify<ELFCLASS::ELFCLASS32>(argv[i], addr, length);
+					break;
+
+				case ELFCLASS::ELFCLASS64:
+					success &= verify<ELFCLASS::ELFCLASS64>(argv[i], addr, length);
+					break;
+
+				default:
+					cerr << argv[i] << ": unsupported class" << endl;
+					success = false;
+			}
+		}
+
+		// Cleanup
+		::munmap(addr, length);
+		::close(fd);
+	}
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}